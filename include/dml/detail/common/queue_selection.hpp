@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_DETAIL_COMMON_QUEUE_SELECTION_HPP
+#define DML_DETAIL_COMMON_QUEUE_SELECTION_HPP
+
+#include <cstdint>
+
+namespace dml::detail
+{
+    /**
+     * @brief Policy of choosing a work queue for a hardware submission
+     */
+    enum class queue_selection : std::uint32_t
+    {
+        round_robin       = 0u, /**< Rotate devices, then queues of the device */
+        least_retried     = 1u, /**< Queue that rejected a submission least recently, then the least occupied one */
+        priority_weighted = 2u, /**< Share of submissions proportional to the priority of a queue */
+        sticky            = 3u  /**< Same queue for a thread until it rejects a submission, then the least retried one */
+    };
+
+    /**
+     * @brief Counters of a work queue
+     */
+    struct queue_counters
+    {
+        std::uint32_t device;      /**< Index of the device */
+        std::uint32_t queue;       /**< Index of the queue in the device */
+        std::int32_t  priority;    /**< Priority of the queue */
+        std::uint64_t submissions; /**< Accepted descriptors */
+        std::uint64_t retries;     /**< Rejected descriptors */
+        std::uint32_t occupancy;   /**< Descriptors waiting in the queue, 0 if the queue doesn't report it */
+        bool          dedicated;   /**< Queue is dedicated, only one thread at a time submits to it */
+    };
+}  // namespace dml::detail
+
+#endif  //DML_DETAIL_COMMON_QUEUE_SELECTION_HPP
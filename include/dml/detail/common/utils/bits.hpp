@@ -0,0 +1,29 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_COMMON_UTILS_BITS_HPP
+#define DML_COMMON_UTILS_BITS_HPP
+
+#include <cstdint>
+
+namespace dml::detail
+{
+    /**
+     * @brief Reverses the order of bits, CRC values are reflected with it
+     */
+    [[nodiscard]] constexpr uint32_t reverse_bits(uint32_t value) noexcept
+    {
+        value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
+        value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
+        value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
+        value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
+        value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
+
+        return value;
+    }
+}  // namespace dml::detail
+
+#endif  //DML_COMMON_UTILS_BITS_HPP
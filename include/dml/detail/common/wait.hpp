@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_DETAIL_COMMON_WAIT_HPP
+#define DML_DETAIL_COMMON_WAIT_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace dml::detail
+{
+    /**
+     * @brief Optimized state entered by UMWAIT, C0.2 saves more power and C0.1 wakes up faster
+     */
+    enum class umwait_state : std::uint32_t
+    {
+        c0_2 = 0u,
+        c0_1 = 1u
+    };
+
+    /**
+     * @brief Stages of waiting for completion: spinning, then UMWAIT, then yielding the CPU
+     */
+    struct wait_parameters
+    {
+        std::uint32_t spin_iterations;
+        std::uint32_t umwait_iterations;
+        std::uint32_t umwait_cycles;
+        umwait_state  state;
+    };
+
+    /**
+     * @brief Number of waits and the stage in which each of them finished
+     */
+    struct wait_counters
+    {
+        std::atomic<std::uint64_t> waits{ 0u };
+        std::atomic<std::uint64_t> spin_completions{ 0u };
+        std::atomic<std::uint64_t> umwait_completions{ 0u };
+        std::atomic<std::uint64_t> yield_completions{ 0u };
+    };
+}  // namespace dml::detail
+
+#endif  //DML_DETAIL_COMMON_WAIT_HPP
@@ -35,6 +35,30 @@ namespace dml::detail::ml
         return { validation_status::success, execution_path_t::submit(view.get_descriptor(), numa_id) };
     }
 
+    template <typename execution_path_t, typename task_view_t, typename executor_t>
+    [[nodiscard]] static std::tuple<validation_status, submission_status> submit(task_view_t      view,
+                                                                                 std::uint32_t    numa_id,
+                                                                                 const executor_t &executor)
+    {
+        if (auto status = execution_path_t::validate(view.get_descriptor()); status != validation_status::success)
+        {
+            return { status, submission_status::failure };
+        }
+
+        // Descriptor must stay in place until the executor runs the task
+        executor(
+            [&dsc = view.get_descriptor(), &record = view.get_completion_record(), numa_id]
+            {
+                // Nobody is there to get the status, waits for the record must end anyway
+                if (execution_path_t::submit(dsc, numa_id) != submission_status::success)
+                {
+                    set_status(record, execution_status::hardware_timeout);
+                }
+            });
+
+        return { validation_status::success, submission_status::success };
+    }
+
     template <typename execution_path_t, typename task_view_t>
     [[nodiscard]] static std::tuple<validation_status, submission_status> execute(task_view_t view, std::uint32_t numa_id) noexcept
     {
@@ -57,11 +81,26 @@ namespace dml::detail::ml
         execution_path_t::wait(view.get_descriptor(), umwait);
     }
 
+    template <typename execution_path_t, typename task_view_t>
+    static void wait(task_view_t view, const wait_parameters &parameters, wait_counters *counters) noexcept
+    {
+        execution_path_t::wait(view.get_descriptor(), parameters, counters);
+    }
+
     template <typename execution_path_t, typename task_view_t>
     [[nodiscard]] static bool finished(task_view_t view) noexcept
     {
         return execution_path_t::finished(view.get_descriptor());
     }
+
+    /**
+     * @brief Frees what a task not waited for holds: state of parts of a split operation and dedicated work queue credits
+     */
+    template <typename task_view_t>
+    static void release(task_view_t view) noexcept
+    {
+        impl::release(view.get_descriptor());
+    }
 }  // namespace dml::detail::ml
 
 #endif  //DML_ML_EXECUTION_PATH
@@ -7,13 +7,21 @@
 #ifndef DML_ML_IMPL_CORE_PATH
 #define DML_ML_IMPL_CORE_PATH
 
+#include <dml/detail/common/queue_selection.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/types.hpp>
+#include <dml/detail/common/wait.hpp>
 
 namespace dml::detail::ml::impl
 {
     void rebind(descriptor& dsc, completion_record& record) noexcept;
 
+    /**
+     * @brief Waits for parts of an operation split on submission and frees their state, and for a descriptor holding
+     * a credit of a dedicated work queue, which it returns
+     */
+    void release(const descriptor& dsc) noexcept;
+
     struct software
     {
         [[nodiscard]] static validation_status validate(const descriptor& dsc) noexcept;
@@ -22,7 +30,11 @@ namespace dml::detail::ml::impl
 
         static void wait(const descriptor& dsc, bool umwait) noexcept;
 
+        static void wait(const descriptor& dsc, const wait_parameters& parameters, wait_counters* counters) noexcept;
+
         [[nodiscard]] static bool finished(const descriptor& dsc) noexcept;
+
+        static void set_parallel_threshold(std::uint32_t threshold) noexcept;
     };
 
     struct hardware
@@ -33,7 +45,17 @@ namespace dml::detail::ml::impl
 
         static void wait(const descriptor& dsc, bool umwait) noexcept;
 
+        static void wait(const descriptor& dsc, const wait_parameters& parameters, wait_counters* counters) noexcept;
+
         [[nodiscard]] static bool finished(const descriptor& dsc) noexcept;
+
+        static void set_queue_selection(queue_selection policy) noexcept;
+
+        static void set_striping_threshold(std::uint32_t threshold) noexcept;
+
+        [[nodiscard]] static std::uint32_t queue_count() noexcept;
+
+        [[nodiscard]] static queue_counters get_queue_counters(std::uint32_t index) noexcept;
     };
 
     struct automatic
@@ -44,7 +66,19 @@ namespace dml::detail::ml::impl
 
         static void wait(descriptor& dsc, bool umwait) noexcept;
 
+        static void wait(descriptor& dsc, const wait_parameters& parameters, wait_counters* counters) noexcept;
+
         [[nodiscard]] static bool finished(descriptor& dsc) noexcept;
+
+        static void calibrate_routing() noexcept;
+
+        [[nodiscard]] static bool load_routing(const char* path) noexcept;
+
+        [[nodiscard]] static bool save_routing(const char* path) noexcept;
+
+        static void reset_routing() noexcept;
+
+        static void set_hybrid_threshold(std::uint32_t threshold) noexcept;
     };
 }  // namespace dml::detail::ml::execution_path
 
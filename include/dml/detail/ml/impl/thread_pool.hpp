@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_ML_IMPL_THREAD_POOL
+#define DML_ML_IMPL_THREAD_POOL
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace dml::core
+{
+    class thread_pool;
+}
+
+namespace dml::detail::ml::impl
+{
+    class thread_pool
+    {
+    public:
+        using task_t = std::function<void()>;
+
+        explicit thread_pool(std::uint32_t threads_count = 0u);
+
+        thread_pool(const thread_pool& other) = delete;
+
+        thread_pool& operator=(const thread_pool& other) = delete;
+
+        ~thread_pool() noexcept;
+
+        void submit(task_t task) const noexcept;
+
+        [[nodiscard]] std::uint32_t size() const noexcept;
+
+        [[nodiscard]] static thread_pool& get_default() noexcept;
+
+        static void set_default_size(std::uint32_t threads_count) noexcept;
+
+    private:
+        struct default_tag
+        {
+        };
+
+        explicit thread_pool(default_tag) noexcept;
+
+        std::unique_ptr<core::thread_pool> own_pool_;
+        core::thread_pool*                 pool_;
+    };
+}  // namespace dml::detail::ml::impl
+
+#endif  //DML_ML_IMPL_THREAD_POOL
@@ -21,6 +21,8 @@ namespace dml::detail::ml
     [[nodiscard]] detail::transfer_size_t get_delta_record_size(completion_record& record) noexcept;
 
     [[nodiscard]] detail::transfer_size_t get_crc_value(completion_record& record) noexcept;
+
+    void set_status(completion_record& record, detail::execution_status status) noexcept;
 }  // namespace dml::detail::ml
 
 #endif  //DML_ML_RESULT_HPP
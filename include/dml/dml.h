@@ -120,7 +120,9 @@ dml_status_t dml_execute_job(dml_job_t *dml_job_ptr, dml_wait_mode_t wait_mode);
 
 /**
  * @brief Performs @ref dml_job_t structure parsing and forming the corresponding processing functions pipeline.
- * An alias for ExecuteJob in case of software path.
+ * An alias for ExecuteJob in case of software path, unless @ref DML_FLAG_ASYNC_SUBMIT is set.
+ * With @ref DML_FLAG_ASYNC_SUBMIT the software path job is queued to internal worker threads,
+ * use @ref dml_check_job or @ref dml_wait_job to get the result.
  *
  * @param[in,out] dml_job_ptr   Pointer to the initialized @ref dml_job_t structure
  *
@@ -45,6 +45,7 @@ namespace dml
 {
 }
 
+#include <dml/hl/crc_stream.hpp>
 #include <dml/hl/data_view.hpp>
 #include <dml/hl/execute.hpp>
 #include <dml/hl/execution_interface.hpp>
@@ -52,5 +53,7 @@ namespace dml
 #include <dml/hl/operations.hpp>
 #include <dml/hl/sequence.hpp>
 #include <dml/hl/submit.hpp>
+#include <dml/hl/thread_pool.hpp>
+#include <dml/hl/wait_policy.hpp>
 
 #endif  //DML_DML_HPP
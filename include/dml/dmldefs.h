@@ -131,6 +131,9 @@ typedef uint8_t dml_internal_data_t;              /**< Hidden internal structure
 #define DML_FLAG_BLOCK_ON_FAULT      0x00000002u /**< Block on Fault Flag for all non flow-control operations */
 #define DML_FLAG_PREFETCH_CACHE      0x00000100u /**< Prefetch result of the operation into LLC */
 
+/* ====== The library flags  ====== */
+#define DML_FLAG_ASYNC_SUBMIT        0x01000000u /**< @ref dml_submit_job queues a software path job to internal worker threads and returns immediately */
+
 /* ====== The operation specific flags  ====== */
 // DML_OP_MEM_MOVE operation specific flag
 #define DML_FLAG_COPY_ONLY                  0x00000020u /**< The move operation is disabled */
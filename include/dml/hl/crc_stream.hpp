@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains @ref crc_stream definition
+ */
+
+#ifndef DML_CRC_STREAM_HPP
+#define DML_CRC_STREAM_HPP
+
+#include <dml/detail/common/specific_flags.hpp>
+#include <dml/detail/common/utils/bits.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <dml/hl/data_view.hpp>
+#include <dml/hl/detail/buffer.hpp>
+#include <dml/hl/execute.hpp>
+#include <dml/hl/operations.hpp>
+#include <dml/hl/result.hpp>
+
+#include <algorithm>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     *
+     * @brief Calculates CRC of data received in fragments
+     *
+     * The stream keeps CRC value between fragments, so the result is the same as @ref crc_operation
+     * on all fragments placed contiguously. Inversion and reflection of the CRC value are done once,
+     * in the constructor and in @ref finalize. Fragments smaller than the internal buffer are
+     * accumulated there and processed by a single operation.
+     *
+     * Usage:
+     * @code
+     * auto stream = dml::crc_stream<dml::software>(crc_seed);
+     * for (auto &fragment: fragments)
+     * {
+     *     auto status = stream.update(dml::make_view(fragment));
+     *     if (status != dml::status_code::ok) return error;
+     * }
+     * auto result = stream.finalize();
+     * @endcode
+     *
+     * @tparam execution_path Type of @ref dmlhl_aux_path
+     * @tparam allocator_t    Type of memory allocator
+     */
+    template <typename execution_path, typename allocator_t = std::allocator<byte_t>>
+    class crc_stream
+    {
+        /**
+         * @brief Type of buffer for accumulated fragments
+         */
+        using buffer_t = detail::buffer_array<byte_t, allocator_t>;
+
+    public:
+        /**
+         * @brief Default size of the buffer for small fragments
+         */
+        static constexpr size_t default_buffer_size = 4096u;
+
+        /**
+         * @brief Constructs a stream
+         *
+         * @param crc_seed    Initial CRC value
+         * @param operation   Instance of @ref crc_operation with options applied to the whole stream
+         * @param buffer_size Size of the buffer for small fragments
+         * @param allocator   Instance of memory allocator
+         */
+        explicit crc_stream(uint32_t      crc_seed,
+                            crc_operation operation   = crc_operation(),
+                            size_t        buffer_size = default_buffer_size,
+                            allocator_t   allocator   = allocator_t()):
+            buffer_(buffer_size, allocator),
+            buffered_size_(0u),
+            bypass_reflection_(detail::intersects(static_cast<detail::operation_specific_flags_t>(operation.get_specific_options()),
+                                                  detail::crc_specific_flag::bypass_crc_inversion_and_reflection)),
+            operation_(operation.bypass_reflection()),
+            crc_value_(bypass_reflection_ ? crc_seed : detail::reverse_bits(~crc_seed))
+        {
+        }
+
+        /**
+         * @brief Adds the next fragment to the stream
+         *
+         * @param src_view @ref data_view to the fragment
+         *
+         * @warning The fragment is either processed or copied, so its memory can be reused after the call
+         *
+         * @return @ref status_code to report success or failure
+         */
+        status_code update(const_data_view src_view)
+        {
+            if (0u == src_view.size())
+            {
+                return status_code::ok;
+            }
+
+            if (src_view.size() > buffer_.get_count() - buffered_size_)
+            {
+                if (auto status = flush(); status != status_code::ok)
+                {
+                    return status;
+                }
+            }
+
+            // Large fragments are processed in place, copying them would cost more than a separate operation
+            if (src_view.size() >= buffer_.get_count())
+            {
+                return process(src_view);
+            }
+
+            std::copy(src_view.data(), src_view.data() + src_view.size(), &buffer_.get(buffered_size_));
+            buffered_size_ += src_view.size();
+
+            return status_code::ok;
+        }
+
+        /**
+         * @brief Processes the rest of the stream and returns the CRC value
+         *
+         * The stream may be updated further, the next result covers all fragments from the beginning.
+         *
+         * @return @ref crc_result
+         */
+        crc_result finalize()
+        {
+            if (auto status = flush(); status != status_code::ok)
+            {
+                return crc_result{ status };
+            }
+
+            return crc_result{ status_code::ok, bypass_reflection_ ? crc_value_ : ~detail::reverse_bits(crc_value_) };
+        }
+
+    private:
+        status_code flush()
+        {
+            if (0u == buffered_size_)
+            {
+                return status_code::ok;
+            }
+
+            auto status = process(make_view(&buffer_.get(0u), buffered_size_));
+
+            if (status == status_code::ok)
+            {
+                buffered_size_ = 0u;
+            }
+
+            return status;
+        }
+
+        status_code process(const_data_view src_view)
+        {
+            auto result = execute<execution_path>(operation_, src_view, crc_value_);
+
+            if (result.status == status_code::ok)
+            {
+                crc_value_ = result.crc_value;
+            }
+
+            return result.status;
+        }
+
+    private:
+        buffer_t      buffer_;            /**< Buffer for small fragments */
+        size_t        buffered_size_;     /**< Number of bytes accumulated in the buffer */
+        bool          bypass_reflection_; /**< The stream returns raw CRC value */
+        crc_operation operation_;         /**< Operation for fragments, the value is inverted by the stream */
+        uint32_t      crc_value_;         /**< CRC value of the processed fragments */
+    };
+}  // namespace dml
+
+#endif  //DML_CRC_STREAM_HPP
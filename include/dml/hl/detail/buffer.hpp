@@ -14,6 +14,7 @@
 
 #include <dml/hl/types.hpp>
 #include <memory>
+#include <utility>
 
 namespace dml::detail
 {
@@ -18,10 +18,49 @@
 #include <dml/hl/execution_path.hpp>
 #include <dml/hl/status_code.hpp>
 
+#include <cstring>
+#include <type_traits>
+
 #include "make_result.hpp"
 
 namespace dml::detail
 {
+    /**
+     * @brief Largest Memory Move that execute does inline on the software path
+     *
+     * Building, validating and dispatching a descriptor takes longer than copying this many bytes.
+     */
+    constexpr std::uint32_t inline_mem_move_max_size = 256u;
+
+    /**
+     * @brief Copies a tiny region in place of a software Memory Move descriptor
+     *
+     * @tparam execution_path_t Type of execution path
+     *
+     * @param src      Pointer to the source memory region
+     * @param dst      Pointer to the destination memory region
+     * @param src_size Size of the source memory region
+     * @param dst_size Size of the destination memory region
+     *
+     * @return true if the copy is done, false if the operation goes through a descriptor
+     */
+    template <typename execution_path_t>
+    inline bool execute_inline_mem_move(const byte_t *src, byte_t *dst, std::uint32_t src_size, std::uint32_t dst_size) noexcept
+    {
+        if constexpr (std::is_same_v<typename execution_path_t::execution_path, ml::execution_path::software>)
+        {
+            // Errors are left to the descriptor, so they are reported the same way
+            if (src != nullptr && dst != nullptr && src_size == dst_size && src_size != 0u && src_size <= inline_mem_move_max_size)
+            {
+                std::memmove(dst, src, src_size);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     /**
      * @brief Provides common execute implementation
      *
@@ -18,6 +18,19 @@
 
 namespace dml::detail
 {
+    /**
+     * @brief Checks whether submission is handed over to the executor
+     *
+     * Only software operations are run by the executor, hardware ones are already asynchronous.
+     * Stack-allocated tasks are run in place as their descriptors move together with the handler.
+     *
+     * @tparam execution_path_t Type of execution path
+     * @tparam allocator_t      Type of allocator
+     */
+    template <typename execution_path_t, typename allocator_t>
+    static constexpr bool is_asynchronous =
+        std::is_same_v<execution_path_t, software> && !std::is_same_v<allocator_t, ml::stack_allocator>;
+
     /**
      * @brief Provides common submit implementation
      *
@@ -55,7 +68,23 @@ namespace dml::detail
 
         auto task_view = detail::get_task_view(op_handler);
 
-        auto [validation_status, submission_status] = submit<execution_path>(task_view, numa_id);
+        auto [validation_status, submission_status] = [&]
+        {
+            if constexpr (is_asynchronous<execution_path_t, typename execution_interface_t::allocator_type>)
+            {
+                // Descriptor lives in the handler's heap buffer, so it stays in place when the handler is moved
+                return submit<execution_path>(task_view,
+                                              numa_id,
+                                              [&executor](auto &&task)
+                                              {
+                                                  executor.execute(std::forward<decltype(task)>(task));
+                                              });
+            }
+            else
+            {
+                return submit<execution_path>(task_view, numa_id);
+            }
+        }();
 
         if (validation_status != detail::validation_status::success)
         {
@@ -18,6 +18,7 @@
 #include <dml/hl/execution_path.hpp>
 #include <dml/hl/operations.hpp>
 #include <dml/hl/sequence.hpp>
+#include <limits>
 
 namespace dml
 {
@@ -121,6 +122,11 @@ namespace dml
                         data_view dst_view,
                         std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max()) noexcept
     {
+        if (detail::execute_inline_mem_move<execution_path>(src_view.data(), dst_view.data(), src_view.size(), dst_view.size()))
+        {
+            return mem_move_result{ status_code::ok };
+        }
+
         return detail::execute<execution_path, mem_move_operation>(
             numa_id,
             [&]
@@ -162,6 +168,11 @@ namespace dml
                         data_view dst_view,
                         std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max()) noexcept
     {
+        if (detail::execute_inline_mem_move<execution_path>(src_view.data(), dst_view.data(), src_view.size(), dst_view.size()))
+        {
+            return mem_copy_result{ status_code::ok };
+        }
+
         return detail::execute<execution_path, mem_copy_operation>(
             numa_id,
             [&]
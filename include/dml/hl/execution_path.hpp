@@ -12,8 +12,11 @@
 #ifndef DML_EXECUTION_PATH_HPP
 #define DML_EXECUTION_PATH_HPP
 
+#include <dml/detail/common/queue_selection.hpp>
 #include <dml/detail/ml/execution_path.hpp>
-#include <thread>
+#include <dml/hl/thread_pool.hpp>
+
+#include <vector>
 
 namespace dml
 {
@@ -24,6 +27,16 @@ namespace dml
      * @{
      */
 
+    /**
+     * @brief Policy of choosing a work queue for a submission on the hardware path
+     */
+    using queue_selection = detail::queue_selection;
+
+    /**
+     * @brief Counters of a work queue, see @ref hardware::get_queue_statistics
+     */
+    using queue_statistics = detail::queue_counters;
+
     /**
      * @brief Represent software execution path
      *
@@ -37,7 +50,21 @@ namespace dml
         struct default_thread_spawner
         {
             /**
-             * @brief Starts a task in a detached standard thread
+             * @brief Constructs spawner that uses the process-wide @ref thread_pool
+             */
+            default_thread_spawner() noexcept = default;
+
+            /**
+             * @brief Constructs spawner that uses a user-provided @ref thread_pool
+             *
+             * @param pool Pool to run tasks on, must outlive all handlers created with this spawner
+             */
+            explicit default_thread_spawner(thread_pool &pool) noexcept: pool_(&pool)
+            {
+            }
+
+            /**
+             * @brief Starts a task on a worker of the thread pool
              *
              * @tparam task_t Type of callable task
              * @param task    Instance of a callable task
@@ -45,8 +72,13 @@ namespace dml
             template <typename task_t>
             void operator()(task_t &&task) const
             {
-                std::thread(std::forward<task_t>(task)).detach();
+                auto &pool = pool_ ? *pool_ : thread_pool::get_default();
+
+                pool.submit(std::forward<task_t>(task));
             }
+
+        private:
+            thread_pool *pool_ = nullptr; /**< Pool to run tasks on, process-wide pool if null */
         };
 
         /**
@@ -58,6 +90,26 @@ namespace dml
          * @brief Proxy for lower level execution path
          */
         using execution_path = detail::ml::execution_path::software;
+
+        /**
+         * @brief Enables splitting of large operations between workers of the process-wide @ref thread_pool
+         *
+         * Memory Move, Fill, Compare, Compare with Pattern, Dualcast, CRC and Cache Flush operations with
+         * transfer size not less than the threshold are executed in cache-aligned parts on the pool,
+         * the calling thread executes parts too. The result is the same as without splitting.
+         * Memory Move of overlapping regions is never split.
+         *
+         * Usage:
+         * @code
+         * dml::software::set_parallel_threshold(16u << 20u);
+         * @endcode
+         *
+         * @param threshold Transfer size in bytes, zero disables splitting (default)
+         */
+        static void set_parallel_threshold(std::uint32_t threshold) noexcept
+        {
+            execution_path::set_parallel_threshold(threshold);
+        }
     };
 
     /**
@@ -96,6 +148,67 @@ namespace dml
          * @brief Proxy for lower level execution path
          */
         using execution_path = detail::ml::execution_path::hardware;
+
+        /**
+         * @brief Sets the policy of choosing a work queue for submissions of all threads
+         *
+         * Policies other than round robin consider work queues of all devices on the NUMA node
+         * and try them one by one until a queue accepts the descriptor:
+         * - least_retried prefers queues that rejected a submission least recently, then the least occupied ones.
+         * - priority_weighted gives each queue a share of submissions proportional to its priority.
+         * - sticky keeps a thread on the queue that accepted its previous descriptor, and moves it
+         *   to the least retried queue when that queue rejects one.
+         *
+         * Usage:
+         * @code
+         * dml::hardware::set_queue_selection(dml::queue_selection::least_retried);
+         * @endcode
+         *
+         * @param policy Policy to use, round robin by default or the one set with DML_HW_QUEUE_SELECTION
+         */
+        static void set_queue_selection(queue_selection policy) noexcept
+        {
+            execution_path::set_queue_selection(policy);
+        }
+
+        /**
+         * @brief Splits large operations into parts executed by all devices on the NUMA node at the same time
+         *
+         * Memory Move, Fill, Compare, Compare Pattern, CRC and Cache Flush operations of this size and larger
+         * are split into page-aligned parts. Each device gets at least one part, and no part is larger than
+         * the maximum transfer size of the devices. Parts go to devices in turn, regardless of the queue selection
+         * policy. Results of the parts are merged into one result when the operation is waited for.
+         *
+         * Overlapping Memory Move, checked comparison results and CRC seeds read from memory are not split.
+         *
+         * Usage:
+         * @code
+         * dml::hardware::set_striping_threshold(64u << 20u);
+         * @endcode
+         *
+         * @param threshold Transfer size in bytes, zero disables striping (default)
+         */
+        static void set_striping_threshold(std::uint32_t threshold) noexcept
+        {
+            execution_path::set_striping_threshold(threshold);
+        }
+
+        /**
+         * @brief Returns counters of work queues of all devices
+         *
+         * Occupancy is reported only by queues that can track it, it is 0 for shared work queues.
+         */
+        static std::vector<queue_statistics> get_queue_statistics()
+        {
+            auto statistics = std::vector<queue_statistics>(execution_path::queue_count());
+
+            for (auto idx = 0u; idx < statistics.size(); ++idx)
+            {
+                statistics[idx] = execution_path::get_queue_counters(idx);
+            }
+
+            return statistics;
+        }
     };
 
     /**
@@ -134,6 +247,78 @@ namespace dml
          * @brief Proxy for lower level execution path
          */
         using execution_path = detail::ml::execution_path::automatic;
+
+        /**
+         * @brief Measures operations on the CPU and the hardware and routes each submission to the one expected to finish first
+         *
+         * Expected times are kept for each operation and transfer size. The hardware time grows with descriptors
+         * already waiting in work queues. Operations and sizes without measurements, and all of them until the first
+         * measurement, are submitted to the hardware first. No operations may be submitted during the call.
+         *
+         * The DML_AUTO_ROUTING environment variable does the same on first submission: the value "calibrate"
+         * measures the operations, any other value is a path to a file that keeps the measurements.
+         *
+         * Usage:
+         * @code
+         * dml::automatic::calibrate_routing();
+         * @endcode
+         */
+        static void calibrate_routing() noexcept
+        {
+            execution_path::calibrate_routing();
+        }
+
+        /**
+         * @brief Reads expected times from a file written by @ref save_routing
+         *
+         * @param path Path to the file
+         *
+         * @return false if the file is missing or malformed, the routing is kept then
+         */
+        static bool load_routing(const char *path) noexcept
+        {
+            return execution_path::load_routing(path);
+        }
+
+        /**
+         * @brief Writes expected times to a file
+         *
+         * Each line holds an operation, "software" or "hardware" and times in nanoseconds for transfer sizes
+         * below 256 B, 1 KB, 4 KB, ... 4 MB and the larger ones. Zero means the time is unknown.
+         *
+         * @param path Path to the file
+         *
+         * @return false if the file can't be written
+         */
+        static bool save_routing(const char *path) noexcept
+        {
+            return execution_path::save_routing(path);
+        }
+
+        /**
+         * @brief Forgets expected times, so all operations are submitted to the hardware first
+         */
+        static void reset_routing() noexcept
+        {
+            execution_path::reset_routing();
+        }
+
+        /**
+         * @brief Splits large operations between the hardware and the CPU
+         *
+         * Memory Move, Fill, Compare, Compare Pattern and CRC operations of this size and larger are executed
+         * on the hardware and a worker of the @ref thread_pool at the same time. The hardware takes the beginning of
+         * the transfer, its share follows the throughput measured on both sides. Results are merged when the operation
+         * is waited for or checked, so they are the same as results of the whole operation.
+         *
+         * Overlapping Memory Move, checked comparison results and CRC seeds read from memory are not split.
+         *
+         * @param threshold Transfer size in bytes, zero disables splitting (default)
+         */
+        static void set_hybrid_threshold(std::uint32_t threshold) noexcept
+        {
+            execution_path::set_hybrid_threshold(threshold);
+        }
     };
 
     /**
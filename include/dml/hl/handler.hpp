@@ -15,6 +15,7 @@
 #include <dml/detail/ml/result.hpp>
 #include <dml/detail/ml/task.hpp>
 #include <dml/hl/detail/handler.hpp>
+#include <dml/hl/wait_policy.hpp>
 
 namespace dml
 {
@@ -83,6 +84,26 @@ namespace dml
             return *this;
         }
 
+        /**
+         * @brief Destructor
+         *
+         * Waits for an operation that is still being processed, as a worker thread or a device writes
+         * into memory owned by this handler. Parts of an operation split between devices are waited
+         * for and freed, and a dedicated work queue gets its credit back.
+         */
+        ~handler() noexcept
+        {
+            if (status_ == status_code::ok && path_ == path_e::software_e)
+            {
+                detail::ml::wait<detail::ml::execution_path::software>(make_view(task_));
+            }
+            else if (status_ == status_code::ok)
+            {
+                // Operation result isn't asked for, so a page fault isn't continued
+                detail::ml::wait<detail::ml::execution_path::hardware>(make_view(task_));
+            }
+        }
+
         /**
          * @brief Checks whether handler is valid
          *
@@ -107,63 +128,89 @@ namespace dml
          */
         auto get() noexcept
         {
-            auto  task_view         = make_view(task_);
-            auto &completion_record = task_view.get_completion_record();
+            return get_result();
+        }
+
+        /**
+         * @brief Get result for a submitted operation, waiting with the given policy
+         *
+         * This methods waits for an operation to finish, blocking current thread.
+         * See @ref wait_policy for details.
+         *
+         * In case handler is not valid, resulting structure status field will contain error status code.
+         *
+         * @param policy Policy of waiting
+         *
+         * @return Result structure for an operation
+         */
+        auto get(const wait_policy &policy) noexcept
+        {
+            return get_result(policy.get_parameters(), policy.get_counters());
+        }
+
+        /**
+         * @brief Checks whether asynchronous operation is finished
+         *
+         * @return False if an operation is still being processed, True otherwise.
+         */
+        [[nodiscard]] bool is_finished() noexcept
+        {
+            auto task_view = make_view(task_);
 
             if (status_ == status_code::ok)
             {
                 switch(path_){
                     case path_e::automatic_e:
-                        detail::ml::wait<detail::ml::execution_path::automatic>(task_view);
-                        break;
+                        return detail::ml::finished<detail::ml::execution_path::automatic>(task_view);
                     case path_e::software_e:
-                        detail::ml::wait<detail::ml::execution_path::software>(task_view);
-                        break;
+                        return detail::ml::finished<detail::ml::execution_path::software>(task_view);
                     case path_e::hardware_e:
-                        detail::ml::wait<detail::ml::execution_path::hardware>(task_view);
-                        break;
+                        return detail::ml::finished<detail::ml::execution_path::hardware>(task_view);
                     default:
-                        detail::ml::wait<detail::ml::execution_path::software>(task_view);
+                        return detail::ml::finished<detail::ml::execution_path::software>(task_view);
                 }
-
-                return detail::make_result<result_type>(completion_record);
             }
             else
             {
-                // Aggregate initialization ensures only first element initialized
-                return result_type{ status_ };
+                return true;
             }
         }
 
+       private:
         /**
-         * @brief Checks whether asynchronous operation is finished
-         *
-         * @return False if an operation is still being processed, True otherwise.
+         * @brief Waits with the given arguments of detail::ml::wait and makes the result
          */
-        [[nodiscard]] bool is_finished() noexcept
+        template <typename... wait_arguments_t>
+        auto get_result(wait_arguments_t... wait_arguments) noexcept
         {
-            auto task_view = make_view(task_);
+            auto  task_view         = make_view(task_);
+            auto &completion_record = task_view.get_completion_record();
 
             if (status_ == status_code::ok)
             {
                 switch(path_){
                     case path_e::automatic_e:
-                        return detail::ml::finished<detail::ml::execution_path::automatic>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::automatic>(task_view, wait_arguments...);
+                        break;
                     case path_e::software_e:
-                        return detail::ml::finished<detail::ml::execution_path::software>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::software>(task_view, wait_arguments...);
+                        break;
                     case path_e::hardware_e:
-                        return detail::ml::finished<detail::ml::execution_path::hardware>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::hardware>(task_view, wait_arguments...);
+                        break;
                     default:
-                        return detail::ml::finished<detail::ml::execution_path::software>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::software>(task_view, wait_arguments...);
                 }
+
+                return detail::make_result<result_type>(completion_record);
             }
             else
             {
-                return true;
+                // Aggregate initialization ensures only first element initialized
+                return result_type{ status_ };
             }
         }
 
-       private:
         template <typename operation_t_, typename allocator_t_>
         friend dml::detail::ml::task_view detail::get_task_view(
             handler<operation_t_, allocator_t_> &h) noexcept;
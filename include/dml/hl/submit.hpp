@@ -19,6 +19,7 @@
 #include <dml/hl/execution_interface.hpp>
 #include <dml/hl/operations.hpp>
 #include <dml/hl/sequence.hpp>
+#include <limits>
 
 namespace dml
 {
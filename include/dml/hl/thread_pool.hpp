@@ -0,0 +1,41 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/17/2023
+ * @brief Contains @ref thread_pool definition
+ */
+
+#ifndef DML_THREAD_POOL_HPP
+#define DML_THREAD_POOL_HPP
+
+#include <dml/detail/ml/impl/thread_pool.hpp>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Pool of long-lived worker threads used for asynchronous software execution
+     *
+     * Workers are pinned to the cores available to the process, each worker has its own
+     * task deque and steals tasks from other workers when idle.
+     *
+     * The process-wide pool is used by @ref software::default_thread_spawner. It is created
+     * on the first asynchronous software submission and has one worker per available core,
+     * unless @ref thread_pool::set_default_size was called before.
+     *
+     * Usage:
+     * @code
+     * auto pool = dml::thread_pool(4);
+     * auto executor = dml::execution_interface(dml::software::default_thread_spawner(pool), std::allocator<dml::byte_t>());
+     *
+     * auto handler = dml::submit<dml::software>(dml::mem_move, dml::make_view(src), dml::make_view(dst), executor);
+     * @endcode
+     */
+    using thread_pool = detail::ml::impl::thread_pool;
+}  // namespace dml
+
+#endif  //DML_THREAD_POOL_HPP
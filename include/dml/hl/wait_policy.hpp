@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/18/2023
+ * @brief Contains @ref wait_policy definition
+ */
+
+#ifndef DML_WAIT_POLICY_HPP
+#define DML_WAIT_POLICY_HPP
+
+#include <dml/detail/common/wait.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Optimized state entered by UMWAIT
+     *
+     * C0.2 saves more power, C0.1 wakes up faster.
+     */
+    using umwait_state = detail::umwait_state;
+
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Number of waits done with a @ref wait_policy and the stage in which each of them finished
+     *
+     * Waits for operations that were already finished are not counted.
+     */
+    struct wait_statistics
+    {
+        std::uint64_t waits;              /**< Number of waits */
+        std::uint64_t spin_completions;   /**< Waits finished while spinning */
+        std::uint64_t umwait_completions; /**< Waits finished while waiting with UMWAIT */
+        std::uint64_t yield_completions;  /**< Waits finished while yielding the CPU */
+    };
+
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Strategy of waiting for an operation to finish
+     *
+     * A wait goes through three stages:
+     * 1. Spinning with pause for the given number of iterations, short operations finish here without any wake-up latency.
+     * 2. Waiting with UMWAIT for the given number of iterations, each one limited by a deadline in TSC cycles.
+     *    If the CPU doesn't support UMWAIT, each iteration is a single pause.
+     * 3. Yielding the CPU to other threads until the operation is finished, so long operations don't occupy a core.
+     *
+     * Copies of a policy share statistics.
+     *
+     * Usage:
+     * @code
+     * auto policy  = dml::wait_policy().spin(1000u).umwait(100u, 10000u, dml::umwait_state::c0_1);
+     * auto handler = dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+     * auto result  = handler.get(policy);
+     *
+     * auto statistics = policy.get_statistics();
+     * @endcode
+     */
+    class wait_policy
+    {
+    public:
+        static constexpr std::uint32_t default_spin_iterations   = 4096u;  /**< Spin iterations of a default policy */
+        static constexpr std::uint32_t default_umwait_iterations = 1024u;  /**< UMWAIT iterations of a default policy */
+        static constexpr std::uint32_t default_umwait_cycles     = 10000u; /**< UMWAIT deadline of a default policy */
+
+        /**
+         * @brief Constructs a policy with default stages and C0.1 state
+         */
+        wait_policy()
+            : parameters_{ default_spin_iterations, default_umwait_iterations, default_umwait_cycles, umwait_state::c0_1 },
+              counters_(std::make_shared<detail::wait_counters>())
+        {
+        }
+
+        /**
+         * @brief Sets number of spin iterations
+         *
+         * @param iterations Number of iterations, zero skips the stage
+         *
+         * @return Self
+         */
+        wait_policy &spin(std::uint32_t iterations) noexcept
+        {
+            parameters_.spin_iterations = iterations;
+
+            return *this;
+        }
+
+        /**
+         * @brief Sets UMWAIT stage
+         *
+         * @param iterations Number of iterations, zero skips the stage
+         * @param cycles     Deadline of each iteration in TSC cycles, the OS may limit it further
+         * @param state      State entered by the CPU
+         *
+         * @return Self
+         */
+        wait_policy &umwait(std::uint32_t iterations, std::uint32_t cycles, umwait_state state = umwait_state::c0_1) noexcept
+        {
+            parameters_.umwait_iterations = iterations;
+            parameters_.umwait_cycles     = cycles;
+            parameters_.state             = state;
+
+            return *this;
+        }
+
+        /**
+         * @brief Returns statistics of all waits done with this policy and its copies
+         */
+        [[nodiscard]] wait_statistics get_statistics() const noexcept
+        {
+            return { counters_->waits.load(std::memory_order_relaxed),
+                     counters_->spin_completions.load(std::memory_order_relaxed),
+                     counters_->umwait_completions.load(std::memory_order_relaxed),
+                     counters_->yield_completions.load(std::memory_order_relaxed) };
+        }
+
+        /**
+         * @brief Returns stages of waiting set for this policy
+         */
+        [[nodiscard]] const detail::wait_parameters &get_parameters() const noexcept
+        {
+            return parameters_;
+        }
+
+        /**
+         * @brief Returns counters updated by waits done with this policy and its copies
+         */
+        [[nodiscard]] detail::wait_counters *get_counters() const noexcept
+        {
+            return counters_.get();
+        }
+
+    private:
+        detail::wait_parameters                parameters_; /**< Stages of waiting */
+        std::shared_ptr<detail::wait_counters> counters_;   /**< Statistics shared by copies */
+    };
+}  // namespace dml
+
+#endif  //DML_WAIT_POLICY_HPP
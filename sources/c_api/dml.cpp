@@ -82,6 +82,8 @@ extern "C" dml_status_t dml_finalize_job(dml_job_t *const dml_job_ptr)
 {
     CHECK_NULL(dml_job_ptr);
 
+    dml::finalize(dml::job_view(dml_job_ptr));
+
     auto state_ptr = std::launder(reinterpret_cast<dml::state *>(dml_job_ptr->internal_data_ptr));
     std::destroy_at(state_ptr);
 
@@ -8,6 +8,7 @@
 #define DML_IMPL_HPP
 
 #include <dml/detail/ml/execution_path.hpp>
+#include <dml/detail/ml/impl/thread_pool.hpp>
 #include <dml/detail/ml/view.hpp>
 
 #include "job_view.hpp"
@@ -74,11 +75,17 @@ namespace dml
         {
             return status;
         }
+        const auto asynchronous = job.asynchronous();
+
         if(job.operation() == DML_OP_MEM_MOVE && job.flags() & DML_FLAG_COPY_ONLY){
             job.set_flags( job.flags() & ~DML_FLAG_COPY_ONLY);
         }
 
-        job.state().task = make_task(job);
+        // Parts of the previous operation may still be running if it wasn't waited for
+        detail::ml::release(make_view(job.state().task));
+
+        job.state().task         = make_task(job);
+        job.state().asynchronous = false;
 
         auto validation_status = detail::validation_status::error;
         auto submission_status = detail::submission_status::failure;
@@ -86,8 +93,25 @@ namespace dml
         switch (job.state().path)
         {
             case DML_PATH_SW:
-                std::tie(validation_status, submission_status) =
-                    detail::ml::submit<detail::ml::execution_path::software>(make_view(job.state().task), job.numa_id());
+                if (asynchronous)
+                {
+                    // Task lives inside the job, so completion record is written right into it
+                    std::tie(validation_status, submission_status) =
+                        detail::ml::submit<detail::ml::execution_path::software>(make_view(job.state().task),
+                                                                                 job.numa_id(),
+                                                                                 [](auto &&task)
+                                                                                 {
+                                                                                     detail::ml::impl::thread_pool::get_default().submit(
+                                                                                         std::forward<decltype(task)>(task));
+                                                                                 });
+
+                    job.state().asynchronous = (submission_status == detail::submission_status::success);
+                }
+                else
+                {
+                    std::tie(validation_status, submission_status) =
+                        detail::ml::submit<detail::ml::execution_path::software>(make_view(job.state().task), job.numa_id());
+                }
                 break;
             case DML_PATH_HW:
                 std::tie(validation_status, submission_status) =
@@ -112,6 +136,18 @@ namespace dml
         return DML_STATUS_OK;
     }
 
+    static inline void finalize(job_view job) noexcept
+    {
+        // Worker thread may still write into the job
+        if (job.state().asynchronous)
+        {
+            detail::ml::wait<detail::ml::execution_path::software>(detail::ml::make_view(job.state().task));
+        }
+
+        // So do parts of a split operation, and their state is freed only once it is waited for
+        detail::ml::release(detail::ml::make_view(job.state().task));
+    }
+
     [[nodiscard]] static inline dml_status_t execute(job_view job, bool umwait) noexcept
     {
         if (auto status = submit(job); status != DML_STATUS_OK)
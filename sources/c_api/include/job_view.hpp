@@ -105,6 +105,11 @@ namespace dml
             return static_cast<uint8_t>((job_ptr_->flags >> 16) & 0xFF);
         }
 
+        [[nodiscard]] bool asynchronous() const noexcept
+        {
+            return (job_ptr_->flags & DML_FLAG_ASYNC_SUBMIT) != 0u;
+        }
+
         [[nodiscard]] auto dif_src_flags() const noexcept
         {
             return static_cast<uint8_t>(job_ptr_->dif_config.flags & 0xFF);
@@ -179,7 +184,8 @@ namespace dml
 
         void set_flags(uint16_t flags) noexcept
         {
-            job_ptr_->flags = (job_ptr_->flags & 0x0000) | flags;
+            // Only the first 16 bits are replaced, operation specific flags and DML_FLAG_ASYNC_SUBMIT are kept
+            job_ptr_->flags = (job_ptr_->flags & ~dml_operation_flags_t(0xFFFFu)) | flags;
         }
     private:
         dml_job_t* const job_ptr_;
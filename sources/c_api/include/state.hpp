@@ -16,6 +16,7 @@ namespace dml
     {
         dml::detail::ml::task<dml::detail::ml::stack_allocator> task;
         dml_path_t                                              path;
+        bool                                                    asynchronous; /**< Last submission was queued to a worker */
     };
 }  // namespace dml
 
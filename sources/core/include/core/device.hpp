@@ -8,6 +8,7 @@
 #define DML_CORE_EXECUTION_DEVICE_HPP
 
 #include <core/types.hpp>
+#include <dml/detail/common/queue_selection.hpp>
 #include <dml/detail/common/status.hpp>
 
 namespace dml::core
@@ -16,12 +17,66 @@ namespace dml::core
     {
     public:
         [[nodiscard]] dml::detail::submission_status submit(const descriptor& dsc) noexcept;
+
+        /**
+         * @brief Sets transfer size starting from which operations are split between workers of the thread pool
+         *
+         * Zero disables splitting, which is the default.
+         */
+        static void set_parallel_threshold(std::uint32_t threshold) noexcept;
     };
 
     class hardware_device
     {
     public:
         [[nodiscard]] dml::detail::submission_status submit(const descriptor& descriptor, std::uint32_t numa_id) noexcept;
+
+        /**
+         * @brief Sets the policy of choosing a work queue, round robin is the default
+         *
+         * The DML_HW_QUEUE_SELECTION environment variable sets the initial policy:
+         * round_robin, least_retried, priority_weighted or sticky.
+         */
+        static void set_queue_selection(dml::detail::queue_selection policy) noexcept;
+
+        /**
+         * @brief Sets transfer size starting from which descriptors are split between all devices on the NUMA node
+         *
+         * Parts are page-aligned and no larger than the maximum transfer size of the devices.
+         * Zero disables striping, which is the default.
+         */
+        static void set_striping_threshold(std::uint32_t threshold) noexcept;
+
+        /**
+         * @brief Returns the number of work queues on all devices
+         */
+        [[nodiscard]] static std::uint32_t queue_count() noexcept;
+
+        /**
+         * @brief Returns counters of a work queue, queues of each device go one after another
+         */
+        [[nodiscard]] static dml::detail::queue_counters get_queue_counters(std::uint32_t index) noexcept;
+
+        /**
+         * @brief Returns the average number of descriptors waiting in a work queue
+         *
+         * Shared work queues of real devices don't report occupancy and count as empty.
+         */
+        [[nodiscard]] static float load() noexcept;
+
+        /**
+         * @brief Returns the credit of a dedicated work queue taken by the descriptor, must be called once it completes
+         *
+         * Does nothing if the descriptor went to a shared work queue or the credit is already returned.
+         */
+        static void retire(const descriptor& descriptor) noexcept;
+
+        /**
+         * @brief Waits for the descriptor if it is still in a dedicated work queue and returns the credit
+         *
+         * Used when nobody waits for the descriptor, other descriptors aren't waited for.
+         */
+        static void release(const descriptor& descriptor) noexcept;
     };
 }  // namespace dml::core
 
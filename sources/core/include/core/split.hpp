@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_SPLIT_HPP
+#define DML_CORE_SPLIT_HPP
+
+#include <core/types.hpp>
+#include <dml/detail/common/wait.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace dml::core
+{
+    /**
+     * @brief State of an operation executed in parts, the whole descriptor is never submitted itself
+     *
+     * Completion records of operations that can be split don't use their last 8 bytes. The state is kept there
+     * while the parts are running, so it goes with the record wherever the record is waited for.
+     */
+    class split_operation
+    {
+    public:
+        virtual ~split_operation() noexcept = default;
+
+        /**
+         * @brief Returns true once all parts are done, waits for them if it is blocking
+         */
+        [[nodiscard]] virtual bool wait(bool blocking) noexcept = 0;
+
+        /**
+         * @brief Waits for all parts in stages of the policy, counters may be null
+         */
+        virtual void wait(const dml::detail::wait_parameters& parameters, dml::detail::wait_counters* counters) noexcept = 0;
+
+        /**
+         * @brief Writes results of all parts to the completion record of the whole descriptor, the status goes last
+         */
+        virtual void merge(const descriptor& dsc) noexcept = 0;
+    };
+
+    /**
+     * @brief Keeps the state in the completion record of the descriptor until @ref gather completes it
+     *
+     * The completion record must be cleared, Memory Move, Fill, Compare, Compare with Pattern, CRC and
+     * Cache Flush can be split.
+     */
+    void attach(const descriptor& dsc, std::unique_ptr<split_operation> state) noexcept;
+
+    /**
+     * @brief Writes the completion record of a split descriptor once all of its parts are done and frees the state
+     *
+     * Returns false while parts are still running, unless it is blocking. Does nothing for other descriptors.
+     */
+    [[nodiscard]] bool gather(const descriptor& dsc, bool blocking) noexcept;
+
+    /**
+     * @brief Same as the blocking @ref gather, parts are waited for in stages of the policy
+     */
+    void gather(const descriptor& dsc, const dml::detail::wait_parameters& parameters, dml::detail::wait_counters* counters) noexcept;
+
+    /**
+     * @brief Returns true if parts of the transfer can be executed independently and merged with @ref merge_parts
+     */
+    [[nodiscard]] bool is_splittable(const descriptor& dsc) noexcept;
+
+    /**
+     * @brief Returns the descriptor for the part of the transfer that starts at the offset
+     *
+     * CRC of a part that doesn't start the transfer begins from zero, as parts are combined later.
+     */
+    [[nodiscard]] descriptor make_part(const descriptor& dsc, transfer_size_t offset, transfer_size_t size) noexcept;
+
+    /**
+     * @brief Converts between the CRC in a completion record and the raw one, the conversion is its own inverse
+     */
+    [[nodiscard]] uint32_t convert_crc(const descriptor& dsc, uint32_t crc_value) noexcept;
+
+    /**
+     * @brief Completed part of a split descriptor
+     */
+    struct split_part
+    {
+        const completion_record* record;
+        transfer_size_t          offset;
+        transfer_size_t          size;
+    };
+
+    /**
+     * @brief Writes results of the parts to the completion record of the whole descriptor, the status goes last
+     *
+     * Parts go in the order of the transfer, the first one with a difference or a status other than success decides
+     * the result. CRC covers all bytes up to the end of that part, so a page fault can be continued from it.
+     */
+    void merge_parts(const descriptor& dsc, const split_part* parts, size_t count) noexcept;
+}  // namespace dml::core
+
+#endif  //DML_CORE_SPLIT_HPP
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_THREAD_POOL_HPP
+#define DML_CORE_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dml::core
+{
+    /**
+     * @brief Pool of long-lived worker threads used by the software device
+     *
+     * Each worker owns a task deque. A worker takes its own tasks from the back
+     * and steals from the front of other workers' deques when its own is empty.
+     * Tasks submitted from a worker thread go to that worker's deque, tasks submitted
+     * from any other thread are distributed across the workers round robin.
+     */
+    class thread_pool
+    {
+    public:
+        using task_t = std::function<void()>;
+
+        explicit thread_pool(std::uint32_t threads_count) noexcept;
+
+        thread_pool(const thread_pool &) = delete;
+
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        ~thread_pool() noexcept;
+
+        void submit(task_t task) noexcept;
+
+        [[nodiscard]] std::uint32_t size() const noexcept;
+
+        /**
+         * @brief Returns the process-wide pool, which is created on first use
+         */
+        [[nodiscard]] static thread_pool &get_instance() noexcept;
+
+        /**
+         * @brief Sets number of workers for the process-wide pool
+         *
+         * Has effect only before the first call to @ref get_instance. Zero means one worker per available core.
+         */
+        static void set_default_size(std::uint32_t threads_count) noexcept;
+
+    private:
+        struct alignas(64u) worker_queue
+        {
+            std::mutex         mutex;
+            std::deque<task_t> tasks;
+        };
+
+        void run(std::uint32_t index) noexcept;
+
+        [[nodiscard]] bool try_pop(std::uint32_t index, task_t &task) noexcept;
+
+        [[nodiscard]] bool try_steal(std::uint32_t index, task_t &task) noexcept;
+
+        void push(std::uint32_t index, task_t &&task) noexcept;
+
+        std::unique_ptr<worker_queue[]> queues_;
+        std::vector<std::thread>        workers_;
+        std::mutex                      sleep_mutex_;
+        std::condition_variable         wake_up_;
+        std::atomic<std::size_t>        pending_tasks_    = 0u;
+        std::atomic<std::uint32_t>      sleeping_workers_ = 0u;
+        std::atomic<std::uint32_t>      next_queue_       = 0u;
+        bool                            stop_             = false;
+    };
+}  // namespace dml::core
+
+#endif  //DML_CORE_THREAD_POOL_HPP
@@ -0,0 +1,24 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_WAIT_HPP
+#define DML_CORE_WAIT_HPP
+
+#include <core/types.hpp>
+#include <dml/detail/common/wait.hpp>
+
+namespace dml::core
+{
+    /**
+     * @brief Waits until the byte becomes non-zero
+     *
+     * Spins for the given number of iterations first, then waits with UMWAIT, and yields the CPU
+     * after that until the byte is written. Counters may be null.
+     */
+    void wait(const volatile byte_t *pointer, const dml::detail::wait_parameters &parameters, dml::detail::wait_counters *counters) noexcept;
+}  // namespace dml::core
+
+#endif  //DML_CORE_WAIT_HPP
@@ -7,98 +7,300 @@
 #include <core/completion_record_views.hpp>
 #include <core/descriptor_views.hpp>
 #include <core/operations.hpp>
+#include <core/thread_pool.hpp>
 #include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "immintrin.h"
 #include "kernels.hpp"
 
 namespace dml::core::kernels
 {
-    void batch(const_view<descriptor, operation::batch> dsc) noexcept
+    /**
+     * @brief Descriptors between two fences, shared by all threads working on it
+     */
+    struct batch_segment
     {
-        auto record = make_view<operation::batch>(get_completion_record(dsc));
+        const descriptor   *operations;
+        size_t              count;
+        std::atomic<size_t> next{ 0u };
+        std::atomic<size_t> done{ 0u };
+        std::atomic<bool>   failed{ false };
+    };
 
-        const auto operations        = reinterpret_cast<descriptor *>(dsc.descriptor_list_address());
-        const auto descriptors_count = dsc.descriptors_count();
+    /**
+     * @brief Cache lines flushed for a Cache Flush descriptor
+     */
+    struct cache_range
+    {
+        std::uintptr_t begin;
+        std::uintptr_t end;
+    };
 
-        auto status = dml::detail::execution_status::processing;
-        auto index  = size_t(0);
+    constexpr std::uintptr_t cache_line_size = 64u;
 
-        while (index < descriptors_count && status == dml::detail::execution_status::processing)
-        {
-            const auto &current_dsc    = operations[index];
-            auto       &current_record = *reinterpret_cast<completion_record *>(any_descriptor(current_dsc).completion_record_address());
+    static bool is_cache_flush(const descriptor &dsc) noexcept
+    {
+        return operation(any_descriptor(dsc).operation()) == operation::cache_flush;
+    }
 
-            auto op = operation(any_descriptor(current_dsc).operation());
+    /**
+     * @brief Sorts the ranges and merges adjacent and overlapping ones
+     */
+    static void coalesce(std::vector<cache_range> &ranges) noexcept
+    {
+        std::sort(ranges.begin(),
+                  ranges.end(),
+                  [](const cache_range &lhs, const cache_range &rhs)
+                  {
+                      return lhs.begin < rhs.begin;
+                  });
+
+        auto last = ranges.begin();
 
-            switch (op)
+        for (auto current = ranges.begin(); current != ranges.end(); ++current)
+        {
+            if (current == last)
             {
-                case operation::nop:
-                    kernels::nop(make_view<operation::nop>(current_dsc));
-                    break;
-                case operation::mem_move:
-                    kernels::mem_move(make_view<operation::mem_move>(current_dsc));
-                    break;
-                case operation::fill:
-                    kernels::fill(make_view<operation::fill>(current_dsc));
-                    break;
-                case operation::compare:
-                    kernels::compare(make_view<operation::compare>(current_dsc));
-                    break;
-                case operation::compare_pattern:
-                    kernels::compare_pattern(make_view<operation::compare_pattern>(current_dsc));
-                    break;
-                case operation::create_delta:
-                    kernels::create_delta(make_view<operation::create_delta>(current_dsc));
-                    break;
-                case operation::apply_delta:
-                    kernels::apply_delta(make_view<operation::apply_delta>(current_dsc));
-                    break;
-                case operation::dualcast:
-                    kernels::dualcast(make_view<operation::dualcast>(current_dsc));
-                    break;
-                case operation::crc:
-                    kernels::crc(make_view<operation::crc>(current_dsc));
-                    break;
-                case operation::copy_crc:
-                    kernels::copy_crc(make_view<operation::copy_crc>(current_dsc));
-                    break;
-                case operation::dif_check:
-                    kernels::dif_check(make_view<operation::dif_check>(current_dsc));
-                    break;
-                case operation::dif_insert:
-                    kernels::dif_insert(make_view<operation::dif_insert>(current_dsc));
-                    break;
-                case operation::dif_strip:
-                    kernels::dif_strip(make_view<operation::dif_strip>(current_dsc));
-                    break;
-                case operation::dif_update:
-                    kernels::dif_update(make_view<operation::dif_update>(current_dsc));
-                    break;
-                case operation::cache_flush:
-                    kernels::cache_flush(make_view<operation::cache_flush>(current_dsc));
-                    break;
-                default:
-                    status = dml::detail::execution_status::batch_error;
+                continue;
             }
 
-            if (any_completion_record(current_record).status() != to_underlying(dml::detail::execution_status::success))
+            if (current->begin <= last->end)
             {
-                status = dml::detail::execution_status::batch_error;
+                last->end = std::max(last->end, current->end);
             }
             else
             {
-                ++index;
+                *(++last) = *current;
+            }
+        }
+
+        ranges.erase(ranges.empty() ? ranges.end() : last + 1, ranges.end());
+    }
+
+    /**
+     * @brief Executes Cache Flush descriptors of a segment with a single fence
+     *
+     * Each descriptor flushes the lines at every 64 bytes from its destination, like the Cache Flush kernel does.
+     * Ranges of all descriptors are merged, so a line shared by several of them is flushed once.
+     */
+    static void flush_segment(const descriptor *operations, size_t count) noexcept
+    {
+        auto invalidate = std::vector<cache_range>();
+        auto write_back = std::vector<cache_range>();
+
+        for (auto index = size_t(0); index < count; ++index)
+        {
+            if (!is_cache_flush(operations[index]))
+            {
+                continue;
+            }
+
+            auto       dsc   = make_view<operation::cache_flush>(operations[index]);
+            const auto begin = dsc.destination_address() & ~(cache_line_size - 1u);
+            const auto end   = begin + (dsc.transfer_size() / cache_line_size) * cache_line_size;
+
+            if (begin == end)
+            {
+                continue;
+            }
+
+            auto &ranges = intersects(dsc.flags(), dml::detail::cache_flush_flag::cache_control) ? invalidate : write_back;
+
+            ranges.push_back({ begin, end });
+        }
+
+        coalesce(invalidate);
+        coalesce(write_back);
+
+        // Flushes are ordered with earlier stores to the same lines, so only their completion is fenced
+        for (auto range : invalidate)
+        {
+            dispatch::cache_flush_unfenced(reinterpret_cast<byte_t *>(range.begin), static_cast<uint32_t>(range.end - range.begin));
+        }
+
+        for (auto range : write_back)
+        {
+            dispatch::cache_write_back_unfenced(reinterpret_cast<byte_t *>(range.begin), static_cast<uint32_t>(range.end - range.begin));
+        }
+
+        _mm_mfence();
+
+        for (auto index = size_t(0); index < count; ++index)
+        {
+            if (is_cache_flush(operations[index]))
+            {
+                auto record = make_view<operation::cache_flush>(get_completion_record(operations[index]));
+
+                record.status() = to_underlying(dml::detail::execution_status::success);
             }
         }
+    }
+
+    static bool execute(const descriptor &current_dsc) noexcept
+    {
+        auto &current_record = *reinterpret_cast<completion_record *>(any_descriptor(current_dsc).completion_record_address());
 
-        if (index == descriptors_count)
+        switch (operation(any_descriptor(current_dsc).operation()))
         {
-            status = dml::detail::execution_status::success;
+            case operation::nop:
+                kernels::nop(make_view<operation::nop>(current_dsc));
+                break;
+            case operation::mem_move:
+                kernels::mem_move(make_view<operation::mem_move>(current_dsc));
+                break;
+            case operation::fill:
+                kernels::fill(make_view<operation::fill>(current_dsc));
+                break;
+            case operation::compare:
+                kernels::compare(make_view<operation::compare>(current_dsc));
+                break;
+            case operation::compare_pattern:
+                kernels::compare_pattern(make_view<operation::compare_pattern>(current_dsc));
+                break;
+            case operation::create_delta:
+                kernels::create_delta(make_view<operation::create_delta>(current_dsc));
+                break;
+            case operation::apply_delta:
+                kernels::apply_delta(make_view<operation::apply_delta>(current_dsc));
+                break;
+            case operation::dualcast:
+                kernels::dualcast(make_view<operation::dualcast>(current_dsc));
+                break;
+            case operation::crc:
+                kernels::crc(make_view<operation::crc>(current_dsc));
+                break;
+            case operation::copy_crc:
+                kernels::copy_crc(make_view<operation::copy_crc>(current_dsc));
+                break;
+            case operation::dif_check:
+                kernels::dif_check(make_view<operation::dif_check>(current_dsc));
+                break;
+            case operation::dif_insert:
+                kernels::dif_insert(make_view<operation::dif_insert>(current_dsc));
+                break;
+            case operation::dif_strip:
+                kernels::dif_strip(make_view<operation::dif_strip>(current_dsc));
+                break;
+            case operation::dif_update:
+                kernels::dif_update(make_view<operation::dif_update>(current_dsc));
+                break;
+            case operation::cache_flush:
+                kernels::cache_flush(make_view<operation::cache_flush>(current_dsc));
+                break;
+            default:
+                return false;
         }
 
+        return any_completion_record(current_record).status() == to_underlying(dml::detail::execution_status::success);
+    }
+
+    static void process(batch_segment &segment) noexcept
+    {
+        for (auto index = segment.next.fetch_add(1u); index < segment.count; index = segment.next.fetch_add(1u))
+        {
+            if (!is_cache_flush(segment.operations[index]) && !execute(segment.operations[index]))
+            {
+                segment.failed.store(true, std::memory_order_relaxed);
+            }
+
+            segment.done.fetch_add(1u, std::memory_order_acq_rel);
+        }
+    }
+
+    /**
+     * @brief Executes descriptors of a segment in any order, returns false if any of them failed
+     *
+     * Cache Flush descriptors are executed together after the others.
+     */
+    static bool execute_segment(const descriptor *operations, size_t count) noexcept
+    {
+        auto &pool = thread_pool::get_instance();
+
+        const auto helpers_count = std::min<size_t>(pool.size(), count) - 1u;
+
+        if (helpers_count == 0u)
+        {
+            auto success = true;
+
+            for (auto index = size_t(0); index < count; ++index)
+            {
+                success &= is_cache_flush(operations[index]) || execute(operations[index]);
+            }
+
+            flush_segment(operations, count);
+
+            return success;
+        }
+
+        // Helpers may start after the segment is done, so the state is shared with them
+        auto segment        = std::make_shared<batch_segment>();
+        segment->operations = operations;
+        segment->count      = count;
+
+        for (auto i = size_t(0); i < helpers_count; ++i)
+        {
+            pool.submit(
+                [segment]
+                {
+                    process(*segment);
+                });
+        }
+
+        // The calling thread takes descriptors too, so the batch never waits for a free worker
+        process(*segment);
+
+        while (segment->done.load(std::memory_order_acquire) != count)
+        {
+            _mm_pause();
+        }
+
+        flush_segment(operations, count);
+
+        return !segment->failed.load(std::memory_order_relaxed);
+    }
+
+    void batch(const_view<descriptor, operation::batch> dsc) noexcept
+    {
+        auto record = make_view<operation::batch>(get_completion_record(dsc));
+
+        const auto operations        = reinterpret_cast<descriptor *>(dsc.descriptor_list_address());
+        const auto descriptors_count = static_cast<size_t>(dsc.descriptors_count());
+
+        const auto fenced = [operations](size_t index)
+        {
+            return (any_descriptor(operations[index]).flags() & to_underlying(dml::detail::flag::fence)) != 0u;
+        };
+
+        auto failed = false;
+        auto index  = size_t(0);
+
+        // Fence splits the batch into segments, which are executed one after another.
+        // After a failure the descriptor with fence and all following ones are abandoned.
+        while (index < descriptors_count && !failed)
+        {
+            auto segment_end = index + 1u;
+
+            while (segment_end < descriptors_count && !fenced(segment_end))
+            {
+                ++segment_end;
+            }
+
+            failed = !execute_segment(operations + index, segment_end - index);
+            index  = segment_end;
+        }
+
+        const auto status = failed ? dml::detail::execution_status::batch_error : dml::detail::execution_status::success;
+
         record.descriptors_completed() = static_cast<transfer_size_t>(index);
 
         _mm_mfence();
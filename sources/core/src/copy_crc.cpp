@@ -28,8 +28,6 @@ namespace dml::core::kernels
         const auto bypass_data_reflection =
             intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_data_reflection);
 
-        dispatch::mem_move(src, dst, transfer_size);
-
         auto reverse = [](uint32_t value)
         {
             value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
@@ -51,8 +49,9 @@ namespace dml::core::kernels
         }
 
         // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-        crc_value =
-            !bypass_data_reflection ? dispatch::crc_reflected(src, transfer_size, crc_value) : dispatch::crc(src, transfer_size, crc_value);
+        // Copy is done by the same kernel, so source is read once
+        crc_value = !bypass_data_reflection ? dispatch::copy_crc_reflected(src, dst, transfer_size, crc_value)
+                                            : dispatch::copy_crc(src, dst, transfer_size, crc_value);
 
         // Bypass inversion and use reverse bit order for CRC completion_record
         if (!bypass_reflection)
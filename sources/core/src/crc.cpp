@@ -4,18 +4,119 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <core/thread_pool.hpp>
 #include <core/utils.hpp>
 #include <dml/detail/common/specific_flags.hpp>
 #include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/bits.hpp>
 #include <dml/detail/common/utils/enum.hpp>
 #include <optimization_dispatcher.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "immintrin.h"
 #include "kernels.hpp"
 
 namespace dml::core::kernels
 {
-    void crc(const_view<descriptor, operation::crc> dsc) noexcept
+    /**
+     * @brief The smallest part of the buffer calculated by one thread
+     */
+    constexpr uint32_t crc_min_part_size = 1u << 20u;
+
+    /**
+     * @brief Parts of the buffer, shared by all threads calculating it
+     */
+    struct crc_parts
+    {
+        const byte_t         *src;
+        uint32_t              transfer_size;
+        uint32_t              part_size;
+        uint32_t              crc_seed;
+        bool                  reflected;
+        std::vector<uint32_t> crc_values;
+        std::atomic<size_t>   next{ 0u };
+        std::atomic<size_t>   done{ 0u };
+    };
+
+    static uint32_t calculate(const byte_t *src, uint32_t transfer_size, uint32_t crc_seed, bool reflected) noexcept
+    {
+        return reflected ? dispatch::crc_reflected(src, transfer_size, crc_seed) : dispatch::crc(src, transfer_size, crc_seed);
+    }
+
+    static void process(crc_parts &parts) noexcept
+    {
+        const auto count = parts.crc_values.size();
+
+        for (auto index = parts.next.fetch_add(1u); index < count; index = parts.next.fetch_add(1u))
+        {
+            const auto offset = static_cast<uint32_t>(index) * parts.part_size;
+            const auto size   = std::min(parts.part_size, parts.transfer_size - offset);
+
+            // Parts are combined later, so only the first one starts from the seed
+            parts.crc_values[index] = calculate(parts.src + offset, size, (index == 0u) ? parts.crc_seed : 0u, parts.reflected);
+
+            parts.done.fetch_add(1u, std::memory_order_acq_rel);
+        }
+    }
+
+    static size_t parts_count(uint32_t transfer_size) noexcept
+    {
+        return std::min<size_t>(thread_pool::get_instance().size(), transfer_size / crc_min_part_size);
+    }
+
+    /**
+     * @brief Calculates CRC of large buffer in parts on the pool and combines them, the result is the same as the serial one
+     */
+    static uint32_t calculate_parallel(const byte_t *src, uint32_t transfer_size, uint32_t crc_seed, bool reflected) noexcept
+    {
+        auto &pool = thread_pool::get_instance();
+
+        const auto count = parts_count(transfer_size);
+
+        // Helpers may start after the calculation is done, so the state is shared with them
+        auto parts           = std::make_shared<crc_parts>();
+        parts->src           = src;
+        parts->transfer_size = transfer_size;
+        parts->part_size     = static_cast<uint32_t>((transfer_size / count + 63u) & ~63u);
+        parts->crc_seed      = crc_seed;
+        parts->reflected     = reflected;
+        parts->crc_values.resize((transfer_size + parts->part_size - 1u) / parts->part_size);
+
+        for (auto i = size_t(1); i < parts->crc_values.size(); ++i)
+        {
+            pool.submit(
+                [parts]
+                {
+                    process(*parts);
+                });
+        }
+
+        // The calling thread takes parts too, so the calculation never waits for a free worker
+        process(*parts);
+
+        while (parts->done.load(std::memory_order_acquire) != parts->crc_values.size())
+        {
+            _mm_pause();
+        }
+
+        auto crc_value = parts->crc_values[0];
+
+        for (auto index = size_t(1); index < parts->crc_values.size(); ++index)
+        {
+            const auto offset = static_cast<uint32_t>(index) * parts->part_size;
+            const auto size   = std::min(parts->part_size, transfer_size - offset);
+
+            crc_value = dispatch::crc_combine(crc_value, parts->crc_values[index], size);
+        }
+
+        return crc_value;
+    }
+
+    static void execute(const_view<descriptor, operation::crc> dsc, bool parallel) noexcept
     {
         auto record = make_view<operation::crc>(get_completion_record(dsc));
 
@@ -27,34 +128,23 @@ namespace dml::core::kernels
         const auto bypass_data_reflection =
             intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_data_reflection);
 
-        auto reverse = [](uint32_t value)
-        {
-            value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
-            value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
-            value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
-            value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
-            value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
-
-            return value;
-        };
-
         auto crc_value = crc_seed;
 
         // Bypass inversion and use reverse bit order for CRC completion_record
         if (!bypass_reflection)
         {
             crc_value = ~(crc_value);
-            crc_value = reverse(crc_value);
+            crc_value = dml::detail::reverse_bits(crc_value);
         }
 
         // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-        crc_value =
-            !bypass_data_reflection ? dispatch::crc_reflected(src, transfer_size, crc_value) : dispatch::crc(src, transfer_size, crc_value);
+        crc_value = parallel ? calculate_parallel(src, transfer_size, crc_value, !bypass_data_reflection)
+                             : calculate(src, transfer_size, crc_value, !bypass_data_reflection);
 
         // Bypass inversion and use reverse bit order for CRC completion_record
         if (!bypass_reflection)
         {
-            crc_value = reverse(crc_value);
+            crc_value = dml::detail::reverse_bits(crc_value);
             crc_value = ~(crc_value);
         }
 
@@ -63,4 +153,21 @@ namespace dml::core::kernels
         _mm_mfence();
         record.status() = to_underlying(dml::detail::execution_status::success);
     }
+
+    void crc(const_view<descriptor, operation::crc> dsc) noexcept
+    {
+        execute(dsc, false);
+    }
+
+    bool crc_parallel(const_view<descriptor, operation::crc> dsc) noexcept
+    {
+        if (parts_count(dsc.transfer_size()) < 2u)
+        {
+            return false;
+        }
+
+        execute(dsc, true);
+
+        return true;
+    }
 }  // namespace dml::core::kernels
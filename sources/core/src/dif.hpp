@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_OWN_DIF_HPP
+#define DML_CORE_OWN_DIF_HPP
+
+#include <core/types.hpp>
+#include <cstring>
+#include <dml/detail/common/specific_flags.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
+
+namespace dml::core::kernels::dif
+{
+    /**
+     * @brief Values of dif_status field of the completion record
+     */
+    constexpr uint8_t guard_mismatch           = 0x01u;
+    constexpr uint8_t application_tag_mismatch = 0x02u;
+    constexpr uint8_t reference_tag_mismatch   = 0x04u;
+    constexpr uint8_t all_f_detect_error       = 0x08u;
+
+    /**
+     * @brief Size of protection information tuple, which follows each protected block
+     */
+    constexpr uint32_t tuple_size = 8u;
+
+    /**
+     * @brief Protection information tuple in host byte order, in memory all fields are big-endian
+     */
+    struct tuple
+    {
+        uint16_t guard;
+        uint16_t application_tag;
+        uint32_t reference_tag;
+    };
+
+    [[nodiscard]] constexpr uint16_t byte_swap(uint16_t value) noexcept
+    {
+        return static_cast<uint16_t>((value << 8u) | (value >> 8u));
+    }
+
+    [[nodiscard]] constexpr uint32_t byte_swap(uint32_t value) noexcept
+    {
+        return (value << 24u) | ((value << 8u) & 0x00FF0000u) | ((value >> 8u) & 0x0000FF00u) | (value >> 24u);
+    }
+
+    [[nodiscard]] inline uint32_t block_size(dif_flags_t dif_flags) noexcept
+    {
+        constexpr uint32_t block_sizes[] = { 512u, 520u, 4096u, 4104u };
+
+        return block_sizes[dif_flags & 0b11u];
+    }
+
+    /**
+     * @brief Calculates guard tag of the block, seed and result inversion are taken from DIF flags
+     */
+    [[nodiscard]] inline uint16_t guard(const byte_t *block, uint32_t block_size, dif_flags_t dif_flags) noexcept
+    {
+        const uint16_t seed = intersects(dif_flags, dml::detail::dif_specific_flag::invert_crc_seed) ? 0xFFFFu : 0u;
+        const uint16_t crc  = dispatch::crc16_t10dif(block, block_size, seed);
+
+        return intersects(dif_flags, dml::detail::dif_specific_flag::invert_crc_result) ? static_cast<uint16_t>(~crc) : crc;
+    }
+
+    [[nodiscard]] inline uint64_t load_raw(const byte_t *tuple_address) noexcept
+    {
+        uint64_t raw = 0u;
+        std::memcpy(&raw, tuple_address, sizeof(raw));
+
+        return raw;
+    }
+
+    [[nodiscard]] inline tuple load(const byte_t *tuple_address) noexcept
+    {
+        const auto raw = load_raw(tuple_address);
+
+        return { byte_swap(static_cast<uint16_t>(raw)),
+                 byte_swap(static_cast<uint16_t>(raw >> 16u)),
+                 byte_swap(static_cast<uint32_t>(raw >> 32u)) };
+    }
+
+    /**
+     * @brief Writes the whole tuple with one 64-bit store
+     */
+    inline void store(byte_t *tuple_address, const tuple &value) noexcept
+    {
+        const uint64_t raw = uint64_t(byte_swap(value.guard)) | uint64_t(byte_swap(value.application_tag)) << 16u |
+                             uint64_t(byte_swap(value.reference_tag)) << 32u;
+
+        std::memcpy(tuple_address, &raw, sizeof(raw));
+    }
+
+    /**
+     * @brief Reference and application tags of the current block, they are updated for each next block
+     */
+    class tags
+    {
+    public:
+        tags(dif_ref_tag_t reference_tag,
+             dif_app_tag_t application_tag,
+             dif_app_tag_t application_tag_mask,
+             bool          fixed_reference_tag,
+             bool          incrementing_application_tag) noexcept
+            : reference_tag_(reference_tag),
+              application_tag_(application_tag),
+              application_tag_mask_(static_cast<dif_app_tag_t>(~application_tag_mask)),
+              reference_tag_increment_(fixed_reference_tag ? 0u : 1u),
+              application_tag_increment_(incrementing_application_tag ? 1u : 0u)
+        {
+        }
+
+        [[nodiscard]] dif_ref_tag_t reference_tag() const noexcept
+        {
+            return reference_tag_;
+        }
+
+        [[nodiscard]] dif_app_tag_t application_tag() const noexcept
+        {
+            return static_cast<dif_app_tag_t>(application_tag_ & application_tag_mask_);
+        }
+
+        [[nodiscard]] bool application_tag_masked_out() const noexcept
+        {
+            return application_tag_mask_ == 0xFFFFu;
+        }
+
+        void next() noexcept
+        {
+            reference_tag_ += reference_tag_increment_;
+            application_tag_ += application_tag_increment_;
+        }
+
+    private:
+        dif_ref_tag_t reference_tag_;
+        dif_app_tag_t application_tag_;
+        dif_app_tag_t application_tag_mask_;
+        dif_ref_tag_t reference_tag_increment_;
+        dif_app_tag_t application_tag_increment_;
+    };
+
+    /**
+     * @brief Result of the source check: DIF status and offset of the first failed block
+     */
+    struct check_result
+    {
+        uint8_t         dif_status;
+        transfer_size_t bytes_completed;
+    };
+
+    /**
+     * @brief Checks protection information of all source blocks, stops on the first failed block
+     */
+    [[nodiscard]] inline check_result check(const byte_t   *src,
+                                            transfer_size_t transfer_size,
+                                            dif_flags_t     dif_flags,
+                                            dif_flags_t     source_flags,
+                                            tags            expected) noexcept
+    {
+        using dml::detail::dif_source_flag;
+
+        const auto block_size  = dif::block_size(dif_flags);
+        const auto step        = block_size + tuple_size;
+        const auto block_count = transfer_size / step;
+
+        const auto check_guard         = !intersects(source_flags, dif_source_flag::guard_check_disable);
+        const auto check_reference_tag = !intersects(source_flags, dif_source_flag::ref_tag_check_disable);
+        const auto all_f_is_error      = intersects(source_flags, dif_source_flag::all_f_detect) &&
+                                    intersects(source_flags, dif_source_flag::enable_all_f_detect_error);
+        const auto app_and_ref_tag_f_detect = intersects(source_flags, dif_source_flag::app_and_ref_tag_f_detect);
+        const auto app_tag_f_detect         = intersects(source_flags, dif_source_flag::app_tag_f_detect);
+
+        for (transfer_size_t block = 0u; block < block_count; ++block, src += step, expected.next())
+        {
+            const auto tuple_address = src + block_size;
+
+            if (all_f_is_error && load_raw(tuple_address) == ~uint64_t(0u))
+            {
+                return { all_f_detect_error, block * step };
+            }
+
+            const auto actual = load(tuple_address);
+
+            // Blocks with all F tags are not checked
+            if ((app_and_ref_tag_f_detect && actual.application_tag == 0xFFFFu && actual.reference_tag == 0xFFFFFFFFu) ||
+                (app_tag_f_detect && actual.application_tag == 0xFFFFu))
+            {
+                continue;
+            }
+
+            uint8_t dif_status = 0u;
+
+            if (check_guard && guard(src, block_size, dif_flags) != actual.guard)
+            {
+                dif_status |= guard_mismatch;
+            }
+
+            if (check_reference_tag && expected.reference_tag() != actual.reference_tag)
+            {
+                dif_status |= reference_tag_mismatch;
+            }
+
+            if (!expected.application_tag_masked_out() && expected.application_tag() != actual.application_tag)
+            {
+                dif_status |= application_tag_mismatch;
+            }
+
+            if (dif_status)
+            {
+                return { dif_status, block * step };
+            }
+        }
+
+        return { 0u, 0u };
+    }
+}  // namespace dml::core::kernels::dif
+
+#endif  //DML_CORE_OWN_DIF_HPP
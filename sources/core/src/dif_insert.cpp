@@ -4,14 +4,13 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
-#include <dml_dif.h>
-
 #include <core/utils.hpp>
-#include <cstring>
+#include <dml/detail/common/specific_flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
 
-#include "../../../../include/dml/dmldefs.h"
+#include "dif.hpp"
 #include "immintrin.h"
 #include "kernels.hpp"
 
@@ -19,42 +18,40 @@ namespace dml::core::kernels
 {
     void dif_insert(const_view<descriptor, operation::dif_insert> dsc) noexcept
     {
+        using dml::detail::dif_destination_flag;
+
         auto record = make_view<operation::dif_insert>(get_completion_record(dsc));
 
-        const auto src              = reinterpret_cast<byte_t *>(dsc.source_address());
-        const auto dst              = reinterpret_cast<byte_t *>(dsc.destination_address());
-        const auto transfer_size    = dsc.transfer_size();
-        const auto options          = dsc.flags();
-        const auto dif_options      = dsc.dif_flags();
-        const auto dif_dst_options  = dsc.destination_dif_flags();
-        const auto dst_app_tag_mask = dsc.destination_app_tag_mask();
+        const auto src             = reinterpret_cast<const byte_t *>(dsc.source_address());
+        const auto dst             = reinterpret_cast<byte_t *>(dsc.destination_address());
+        const auto transfer_size   = dsc.transfer_size();
+        const auto dif_options     = dsc.dif_flags();
+        const auto dif_dst_options = dsc.destination_dif_flags();
 
-        auto dst_ref_tag = dsc.destination_ref_tag();
-        auto dst_app_tag = dsc.destination_app_tag();
+        const auto block_size  = dif::block_size(dif_options);
+        const auto block_count = transfer_size / block_size;
 
-        dml_job_t job;
-        memset(&job, 0, sizeof(dml_job_t));
-        job.source_first_ptr                            = src;
-        job.destination_first_ptr                       = dst;
-        job.source_length                               = transfer_size;
-        job.operation                                   = DML_OP_DIF_INSERT;
-        job.dif_config.destination_reference_tag_seed   = dst_ref_tag;
-        job.dif_config.destination_application_tag_seed = dst_app_tag;
-        job.dif_config.destination_application_tag_mask = dst_app_tag_mask;
-        job.dif_config.block_size                       = static_cast<dml_dif_block_size_t>(dif_options & 0b11);
+        auto tags = dif::tags(dsc.destination_ref_tag(),
+                              dsc.destination_app_tag(),
+                              dsc.destination_app_tag_mask(),
+                              intersects(dif_dst_options, dif_destination_flag::fixed_ref_tag_type),
+                              intersects(dif_dst_options, dif_destination_flag::incrementing_app_tag_type));
 
-        // Job API composes DIF flags into one 64-bit value via shifting, check dmldefs.h
-        job.dif_config.flags = (uint64_t(dif_options) << 16) | (uint64_t(dif_dst_options) << 8);
+        for (transfer_size_t block = 0u; block < block_count; ++block, tags.next())
+        {
+            const auto source_block      = src + block * block_size;
+            const auto destination_block = dst + block * (block_size + dif::tuple_size);
 
-        job.flags = options;
+            dispatch::mem_move(source_block, destination_block, block_size);
 
-        auto status = dml_legacy_dif_insert(&job);
+            dif::store(destination_block + block_size,
+                       { dif::guard(destination_block, block_size, dif_options), tags.application_tag(), tags.reference_tag() });
+        }
 
-        record.bytes_completed() = job.offset;
+        record.bytes_completed() = 0u;
         // TODO: Tags should be written
 
         _mm_mfence();
-        record.status() = to_underlying((status == DML_STATUS_OK) ? dml::detail::execution_status::success
-                                                                  : dml::detail::execution_status::dif_control_error);
+        record.status() = to_underlying(dml::detail::execution_status::success);
     }
 }  // namespace dml::core::kernels
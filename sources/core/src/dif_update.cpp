@@ -4,14 +4,13 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
-#include <dml_dif.h>
-
 #include <core/utils.hpp>
-#include <cstring>
+#include <dml/detail/common/specific_flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
 
-#include "../../../../include/dml/dmldefs.h"
+#include "dif.hpp"
 #include "immintrin.h"
 #include "kernels.hpp"
 
@@ -19,50 +18,77 @@ namespace dml::core::kernels
 {
     void dif_update(const_view<descriptor, operation::dif_update> dsc) noexcept
     {
+        using dml::detail::dif_destination_flag;
+        using dml::detail::dif_source_flag;
+
         auto record = make_view<operation::dif_update>(get_completion_record(dsc));
 
-        const auto src              = reinterpret_cast<byte_t *>(dsc.source_address());
-        const auto dst              = reinterpret_cast<byte_t *>(dsc.destination_address());
-        const auto transfer_size    = dsc.transfer_size();
-        const auto options          = dsc.flags();
-        const auto dif_options      = dsc.dif_flags();
-        const auto dif_src_options  = dsc.source_dif_flags();
-        const auto dif_dst_options  = dsc.destination_dif_flags();
-        const auto src_app_tag_mask = dsc.source_app_tag_mask();
-        const auto dst_app_tag_mask = dsc.destination_app_tag_mask();
-
-        auto src_ref_tag = dsc.source_ref_tag();
-        auto dst_ref_tag = dsc.destination_ref_tag();
-        auto src_app_tag = dsc.source_app_tag();
-        auto dst_app_tag = dsc.destination_app_tag();
-
-        dml_job_t job;
-        memset(&job, 0, sizeof(dml_job_t));
-        job.source_first_ptr                            = src;
-        job.destination_first_ptr                       = dst;
-        job.source_length                               = transfer_size;
-        job.operation                                   = DML_OP_DIF_UPDATE;
-        job.dif_config.source_reference_tag_seed        = src_ref_tag;
-        job.dif_config.source_application_tag_seed      = src_app_tag;
-        job.dif_config.source_application_tag_mask      = src_app_tag_mask;
-        job.dif_config.destination_reference_tag_seed   = dst_ref_tag;
-        job.dif_config.destination_application_tag_seed = dst_app_tag;
-        job.dif_config.destination_application_tag_mask = dst_app_tag_mask;
-        job.dif_config.block_size                       = static_cast<dml_dif_block_size_t>(dif_options & 0b11);
-
-        // Job API composes DIF flags into one 64-bit value via shifting, check dmldefs.h
-        job.dif_config.flags = (uint64_t(dif_options) << 16) | (uint64_t(dif_dst_options) << 8) | dif_src_options;
-
-        job.flags = static_cast<flags_t>(options);
-
-        auto status = dml_legacy_dif_update(&job);
-
-        record.dif_status()      = job.result;
-        record.bytes_completed() = job.offset;
+        const auto src             = reinterpret_cast<const byte_t *>(dsc.source_address());
+        const auto dst             = reinterpret_cast<byte_t *>(dsc.destination_address());
+        const auto transfer_size   = dsc.transfer_size();
+        const auto dif_options     = dsc.dif_flags();
+        const auto dif_src_options = dsc.source_dif_flags();
+        const auto dif_dst_options = dsc.destination_dif_flags();
+
+        const auto expected = dif::tags(dsc.source_ref_tag(),
+                                        dsc.source_app_tag(),
+                                        dsc.source_app_tag_mask(),
+                                        intersects(dif_src_options, dif_source_flag::fixed_ref_tag_type),
+                                        intersects(dif_src_options, dif_source_flag::incrementing_app_tag_type));
+
+        const auto result = dif::check(src, transfer_size, dif_options, dif_src_options, expected);
+
+        if (0u == result.dif_status)
+        {
+            const auto calculate_guard           = !intersects(dif_dst_options, dif_destination_flag::guard_field_pass_through);
+            const auto calculate_application_tag = !intersects(dif_dst_options, dif_destination_flag::app_tag_pass_through);
+            const auto calculate_reference_tag   = !intersects(dif_dst_options, dif_destination_flag::ref_tag_pass_through);
+
+            const auto block_size  = dif::block_size(dif_options);
+            const auto step        = block_size + dif::tuple_size;
+            const auto block_count = transfer_size / step;
+
+            auto tags = dif::tags(dsc.destination_ref_tag(),
+                                  dsc.destination_app_tag(),
+                                  dsc.destination_app_tag_mask(),
+                                  intersects(dif_dst_options, dif_destination_flag::fixed_ref_tag_type),
+                                  intersects(dif_dst_options, dif_destination_flag::incrementing_app_tag_type));
+
+            for (transfer_size_t block = 0u; block < block_count; ++block, tags.next())
+            {
+                const auto source_block      = src + block * step;
+                const auto destination_block = dst + block * step;
+
+                // Fields which are passed through are taken from the source tuple
+                auto tuple = dif::load(source_block + block_size);
+
+                dispatch::mem_move(source_block, destination_block, block_size);
+
+                if (calculate_guard)
+                {
+                    tuple.guard = dif::guard(destination_block, block_size, dif_options);
+                }
+
+                if (calculate_application_tag)
+                {
+                    tuple.application_tag = tags.application_tag();
+                }
+
+                if (calculate_reference_tag)
+                {
+                    tuple.reference_tag = tags.reference_tag();
+                }
+
+                dif::store(destination_block + block_size, tuple);
+            }
+        }
+
+        record.dif_status()      = result.dif_status;
+        record.bytes_completed() = result.bytes_completed;
         // TODO: Tags should be written
 
         _mm_mfence();
-        record.status() = to_underlying((status == DML_STATUS_OK) ? dml::detail::execution_status::success
-                                                                  : dml::detail::execution_status::dif_control_error);
+        record.status() = to_underlying((0u == result.dif_status) ? dml::detail::execution_status::success
+                                                                   : dml::detail::execution_status::dif_control_error);
     }
 }  // namespace dml::core::kernels
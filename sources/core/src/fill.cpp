@@ -5,6 +5,7 @@
  ******************************************************************************/
 
 #include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
 #include <optimization_dispatcher.hpp>
@@ -22,7 +23,15 @@ namespace dml::core::kernels
         const auto dst           = reinterpret_cast<byte_t *>(dsc.destination_address());
         const auto transfer_size = dsc.transfer_size();
 
-        dispatch::fill(pattern, dst, transfer_size);
+        // Data isn't expected to be read soon unless the cache control flag is set
+        if (intersects(dsc.flags(), dml::detail::fill_flag::cache_control))
+        {
+            dispatch::fill(pattern, dst, transfer_size);
+        }
+        else
+        {
+            dispatch::fill_non_temporal(pattern, dst, transfer_size);
+        }
 
         _mm_mfence();
         record.status() = to_underlying(dml::detail::execution_status::success);
@@ -12,10 +12,71 @@
 #include "hw_dispatcher/hw_dispatcher.hpp"
 #include "hw_dispatcher/numa.hpp"
 
+#if defined(__linux__)
+#include <core/descriptor_views.hpp>
+#include <core/split.hpp>
+#include <core/wait.hpp>
+#include <dml/detail/common/flags.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "immintrin.h"
+#endif
+
 namespace dml::core
 {
 #if defined(__linux__)
-    static inline auto enqueue(const dispatcher::hw_device &device, const descriptor &dsc) noexcept
+    static constexpr auto max_queues = MAX_DEVICE_COUNT * MAX_WORK_QUEUE_COUNT;
+
+    /**
+     * @brief Work queue that can take a submission, with its index among queues of all devices
+     */
+    struct queue_candidate
+    {
+        const dispatcher::hw_queue *queue;
+        uint32_t                    index;
+        uint64_t                    last_retry; /**< Counters of the queue taken before ordering, as other threads change them */
+        uint32_t                    occupancy;
+    };
+
+    using candidates_t = std::array<queue_candidate, max_queues>;
+
+    static auto get_initial_queue_selection() noexcept
+    {
+        static constexpr struct
+        {
+            const char                    *name;
+            dml::detail::queue_selection policy;
+        } policies[] = { { "round_robin", dml::detail::queue_selection::round_robin },
+                         { "least_retried", dml::detail::queue_selection::least_retried },
+                         { "priority_weighted", dml::detail::queue_selection::priority_weighted },
+                         { "sticky", dml::detail::queue_selection::sticky } };
+
+        if (const auto *name = std::getenv("DML_HW_QUEUE_SELECTION"); name != nullptr)
+        {
+            for (const auto &entry : policies)
+            {
+                if (std::strcmp(entry.name, name) == 0)
+                {
+                    return entry.policy;
+                }
+            }
+        }
+
+        return dml::detail::queue_selection::round_robin;
+    }
+
+    static std::atomic<dml::detail::queue_selection> queue_selection = get_initial_queue_selection();
+
+    static inline void clear_completion_record(const descriptor &dsc) noexcept
     {
         // Write 0 to completion record before submit
         auto &record = get_completion_record(dsc);
@@ -23,52 +84,496 @@ namespace dml::core
         {
             byte = 0u;
         }
+    }
+
+    static inline auto enqueue(const dispatcher::hw_device &device, const descriptor &dsc) noexcept
+    {
+        clear_completion_record(dsc);
 
         auto status = device.enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&dsc));
 
         return status == DML_STATUS_OK ? dml::detail::submission_status::success
                                        : dml::detail::submission_status::failure;
     }
-#endif
 
-    dml::detail::submission_status hardware_device::submit(const descriptor &dsc, std::uint32_t numa_id) noexcept
+    static auto submit_round_robin(const dispatcher::hw_dispatcher &dispatcher, const descriptor &dsc, uint32_t numa_id) noexcept
     {
-#if defined(__linux__)
-        const auto own_numa_id = (numa_id == std::numeric_limits<decltype(numa_id)>::max()) ? util::get_numa_id() : numa_id;
-
-        auto &dispatcher = dispatcher::hw_dispatcher::get_instance();
         const size_t device_count = dispatcher.device_count();
 
-        if (dispatcher.is_hw_support())
+        static thread_local auto current_device_idx = 0u;
+        size_t tried_devices = 0u;
+
+        while (tried_devices < device_count)
         {
-            static thread_local auto current_device_idx = 0u;
-            size_t tried_devices = 0u;
+            const auto &current_device = dispatcher.device(current_device_idx);
+            current_device_idx = (current_device_idx + 1) % device_count;
 
-            while (tried_devices < device_count)
+            if (numa_id != current_device.numa_id())
             {
-                const auto &current_device = dispatcher.device(current_device_idx);
-                current_device_idx = (current_device_idx + 1) % device_count;
+                tried_devices++;
+                continue;
+            }
+
+            auto status = enqueue(current_device, dsc);
 
-                if (own_numa_id != current_device.numa_id())
+            if (status != dml::detail::submission_status::success)
+            {
+                tried_devices++;
+            }
+            else
+            {
+                return status;
+            }
+        }
+
+        return dml::detail::submission_status::queue_busy;
+    }
+
+    /**
+     * @brief Collects queues of devices on the NUMA node, starting from a queue that changes with every call of a thread
+     *
+     * The rotation spreads threads between queues that policies can't tell apart.
+     */
+    static auto collect_candidates(const dispatcher::hw_dispatcher &dispatcher, uint32_t numa_id, candidates_t &candidates) noexcept
+    {
+        static thread_local auto rotation = 0u;
+
+        auto count      = 0u;
+        auto device_idx = 0u;
+
+        for (const auto &device : dispatcher)
+        {
+            if (numa_id == device.numa_id())
+            {
+                for (auto queue_idx = 0u; queue_idx < device.size(); ++queue_idx)
                 {
-                    tried_devices++;
-                    continue;
+                    candidates[count++] = { &*(device.begin() + queue_idx), device_idx * MAX_WORK_QUEUE_COUNT + queue_idx, 0u, 0u };
                 }
+            }
+
+            device_idx++;
+        }
+
+        if (count != 0u)
+        {
+            std::rotate(candidates.begin(), candidates.begin() + (rotation++ % count), candidates.begin() + count);
+        }
 
-                auto status = enqueue(current_device, dsc);
+        return count;
+    }
 
-                if (status != dml::detail::submission_status::success)
+    /**
+     * @brief Orders queues so that the ones that rejected a submission most recently, then the most occupied ones, go last
+     */
+    static void order_by_retries(queue_candidate *begin, queue_candidate *end) noexcept
+    {
+        // Sorting needs keys that don't change while it runs
+        for (auto it = begin; it != end; ++it)
+        {
+            it->last_retry = it->queue->last_retry();
+            it->occupancy  = it->queue->occupancy();
+        }
+
+        std::stable_sort(begin,
+                         end,
+                         [](const queue_candidate &a, const queue_candidate &b)
+                         {
+                             return (a.last_retry != b.last_retry) ? a.last_retry < b.last_retry : a.occupancy < b.occupancy;
+                         });
+    }
+
+    /**
+     * @brief Moves the queue picked by smooth weighted round robin on priorities to the front, the others follow by priority
+     */
+    static void order_by_priority(queue_candidate *begin, queue_candidate *end) noexcept
+    {
+        static thread_local std::array<int64_t, max_queues> current_weights = {};
+
+        if (begin == end)
+        {
+            return;
+        }
+
+        const auto weight = [](const queue_candidate &candidate) -> int64_t
+        {
+            return std::max(candidate.queue->priority(), 1);
+        };
+
+        auto total    = int64_t(0);
+        auto selected = begin;
+
+        for (auto it = begin; it != end; ++it)
+        {
+            current_weights[it->index] += weight(*it);
+            total += weight(*it);
+
+            if (current_weights[it->index] > current_weights[selected->index])
+            {
+                selected = it;
+            }
+        }
+
+        current_weights[selected->index] -= total;
+
+        std::rotate(begin, selected, selected + 1);
+        std::stable_sort(begin + 1,
+                         end,
+                         [&weight](const queue_candidate &a, const queue_candidate &b)
+                         {
+                             return weight(a) > weight(b);
+                         });
+    }
+
+    /**
+     * @brief Tries queues in order, returns the first one that accepted the descriptor or end
+     */
+    static auto enqueue_first(queue_candidate *begin, queue_candidate *end, const descriptor &dsc) noexcept
+    {
+        return std::find_if(begin,
+                            end,
+                            [&dsc](const queue_candidate &candidate)
+                            {
+                                return DML_STATUS_OK == candidate.queue->enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&dsc));
+                            });
+    }
+
+    static auto submit_with_policy(const dispatcher::hw_dispatcher &dispatcher,
+                                   const descriptor                 &dsc,
+                                   uint32_t                          numa_id,
+                                   dml::detail::queue_selection      policy) noexcept
+    {
+        static thread_local auto sticky_index = std::numeric_limits<uint32_t>::max();
+
+        auto candidates = candidates_t();
+        auto begin      = candidates.data();
+        auto end        = begin + collect_candidates(dispatcher, numa_id, candidates);
+
+        clear_completion_record(dsc);
+
+        switch (policy)
+        {
+            case dml::detail::queue_selection::sticky:
+            {
+                auto sticky = std::find_if(begin,
+                                           end,
+                                           [](const queue_candidate &candidate)
+                                           {
+                                               return candidate.index == sticky_index;
+                                           });
+
+                if (sticky != end)
                 {
-                    tried_devices++;
+                    // Spill over to the other queues only when this one rejects the descriptor
+                    std::rotate(begin, sticky, sticky + 1);
+                    order_by_retries(begin + 1, end);
                 }
                 else
                 {
-                    return status;
+                    order_by_retries(begin, end);
                 }
+                break;
             }
+            case dml::detail::queue_selection::priority_weighted:
+                order_by_priority(begin, end);
+                break;
+            default:
+                order_by_retries(begin, end);
+                break;
+        }
+
+        const auto accepted = enqueue_first(begin, end, dsc);
 
+        if (accepted == end)
+        {
             return dml::detail::submission_status::queue_busy;
         }
+
+        sticky_index = accepted->index;
+
+        return dml::detail::submission_status::success;
+    }
+
+    static std::atomic<uint32_t> striping_threshold{ 0u };
+
+    /**
+     * @brief Parts of a descriptor are submitted to different devices, the whole descriptor is never submitted
+     */
+    struct stripe_part
+    {
+        descriptor        dsc;
+        completion_record record;
+        uint32_t          offset;
+        bool              retired;
+    };
+
+    class stripe final : public split_operation
+    {
+    public:
+        ~stripe() noexcept override;
+
+        [[nodiscard]] bool wait(bool blocking) noexcept override;
+
+        void wait(const dml::detail::wait_parameters &parameters, dml::detail::wait_counters *counters) noexcept override;
+
+        void merge(const descriptor &dsc) noexcept override;
+
+        std::vector<stripe_part> parts;
+    };
+
+    static constexpr auto max_stripe_parts = 64u;
+
+    /**
+     * @brief Rounds of tries over all devices for a part, the part is executed on the CPU after that
+     */
+    static constexpr auto max_stripe_retries = 1024u;
+
+    /**
+     * @brief Returns the size of parts the descriptor is split into, 0 if it isn't striped
+     *
+     * Each local device gets at least one part, and no part is larger than any device can take.
+     */
+    static uint32_t get_stripe_size(const dispatcher::hw_dispatcher &dispatcher, const descriptor &dsc, uint32_t numa_id) noexcept
+    {
+        constexpr auto page_size = 0x1000u;
+
+        const auto threshold     = striping_threshold.load(std::memory_order_relaxed);
+        const auto transfer_size = any_descriptor(dsc).transfer_size();
+
+        if (threshold == 0u || transfer_size < threshold || !is_splittable(dsc))
+        {
+            return 0u;
+        }
+
+        auto devices           = 0u;
+        auto max_transfer_size = std::numeric_limits<uint32_t>::max();
+
+        for (const auto &device : dispatcher)
+        {
+            if (numa_id == device.numa_id() && device.size() != 0u)
+            {
+                devices++;
+                max_transfer_size = std::min(max_transfer_size, device.max_transfer_size());
+            }
+        }
+
+        if (devices == 0u || max_transfer_size == 0u)
+        {
+            return 0u;
+        }
+
+        // Maximum transfer size is a power of two, so aligned parts never exceed it.
+        // Page-aligned parts keep patterns in phase
+        const auto alignment = std::min(page_size, max_transfer_size);
+        const auto count     = std::max<uint64_t>(devices, (uint64_t(transfer_size) + max_transfer_size - 1u) / max_transfer_size);
+        const auto part_size = std::min<uint64_t>(max_transfer_size,
+                                                  ((transfer_size + count - 1u) / count + alignment - 1u) & ~uint64_t(alignment - 1u));
+
+        const auto parts_count = (transfer_size + part_size - 1u) / part_size;
+
+        if (parts_count < 2u || parts_count > max_stripe_parts)
+        {
+            return 0u;
+        }
+
+        return static_cast<uint32_t>(part_size);
+    }
+
+    static auto make_stripe(const descriptor &dsc, uint32_t part_size) noexcept
+    {
+        constexpr auto completion_record_flags = to_underlying(dml::detail::flag::completion_record_address_valid) |
+                                                 to_underlying(dml::detail::flag::request_completion_record);
+
+        auto       whole         = any_descriptor(dsc);
+        const auto transfer_size = whole.transfer_size();
+
+        auto result = std::make_unique<stripe>();
+        result->parts.resize((transfer_size + part_size - 1u) / part_size);
+
+        auto offset = 0u;
+
+        for (auto &part : result->parts)
+        {
+            part.dsc     = make_part(dsc, offset, std::min(part_size, transfer_size - offset));
+            part.offset  = offset;
+            part.retired = false;
+
+            auto view = any_descriptor(part.dsc);
+
+            view.completion_record_address() = reinterpret_cast<address_t>(&part.record);
+            view.flags() |= completion_record_flags;
+
+            offset += part_size;
+        }
+
+        return result;
+    }
+
+    static void retire_part(stripe_part &part) noexcept
+    {
+        if (!part.retired)
+        {
+            hardware_device::retire(part.dsc);
+            part.retired = true;
+        }
+    }
+
+    /**
+     * @brief Submits parts to local devices in turn, a part goes to the next device that accepts it
+     *
+     * Parts after the first one are retried with a pause between rounds, and executed on the CPU if no device
+     * accepts them for too long. Completed parts return their dedicated queue credits meanwhile, so the retries
+     * can't wait on the stripe itself.
+     */
+    static auto submit_striped(const dispatcher::hw_dispatcher &dispatcher,
+                               const descriptor                 &dsc,
+                               uint32_t                          numa_id,
+                               uint32_t                          part_size) noexcept
+    {
+        static thread_local auto rotation = 0u;
+
+        std::array<const dispatcher::hw_device *, MAX_DEVICE_COUNT> devices = {};
+
+        auto devices_count = 0u;
+
+        for (const auto &device : dispatcher)
+        {
+            if (numa_id == device.numa_id() && device.size() != 0u)
+            {
+                devices[devices_count++] = &device;
+            }
+        }
+
+        auto current = make_stripe(dsc, part_size);
+
+        const auto first_device = rotation++;
+
+        clear_completion_record(dsc);
+
+        for (auto idx = 0u; idx < current->parts.size(); ++idx)
+        {
+            auto &part     = current->parts[idx];
+            auto  accepted = false;
+
+            for (auto retry = 0u; !accepted; ++retry)
+            {
+                for (auto tried = 0u; tried < devices_count && !accepted; ++tried)
+                {
+                    const auto &device = *devices[(first_device + idx + tried) % devices_count];
+
+                    accepted = enqueue(device, part.dsc) == dml::detail::submission_status::success;
+                }
+
+                if (accepted)
+                {
+                    break;
+                }
+
+                if (idx == 0u)
+                {
+                    return dml::detail::submission_status::queue_busy;
+                }
+
+                if (retry == max_stripe_retries)
+                {
+                    // Parts before this one are running, so it can't fail. The record is written synchronously
+                    static_cast<void>(software_device().submit(part.dsc));
+                    part.retired = true;
+                    break;
+                }
+
+                for (auto submitted = 0u; submitted < idx; ++submitted)
+                {
+                    if (current->parts[submitted].record.bytes[0] != 0u)
+                    {
+                        retire_part(current->parts[submitted]);
+                    }
+                }
+
+                _mm_pause();
+            }
+        }
+
+        attach(dsc, std::move(current));
+
+        return dml::detail::submission_status::success;
+    }
+
+    void stripe::merge(const descriptor &dsc) noexcept
+    {
+        std::array<split_part, max_stripe_parts> merged = {};
+
+        for (auto idx = 0u; idx < parts.size(); ++idx)
+        {
+            merged[idx] = { &parts[idx].record, parts[idx].offset, any_descriptor(parts[idx].dsc).transfer_size() };
+        }
+
+        merge_parts(dsc, merged.data(), parts.size());
+    }
+
+    bool stripe::wait(bool blocking) noexcept
+    {
+        for (auto &part : parts)
+        {
+            if (part.record.bytes[0] == 0u)
+            {
+                if (!blocking)
+                {
+                    return false;
+                }
+
+                dispatch::wait_busy_poll(&part.record.bytes[0]);
+            }
+        }
+
+        return true;
+    }
+
+    void stripe::wait(const dml::detail::wait_parameters &parameters, dml::detail::wait_counters *counters) noexcept
+    {
+        for (auto &part : parts)
+        {
+            if (part.record.bytes[0] == 0u)
+            {
+                core::wait(&part.record.bytes[0], parameters, counters);
+
+                // The stripe counts as one wait, finished in the stage its first running part did
+                counters = nullptr;
+            }
+        }
+    }
+
+    stripe::~stripe() noexcept
+    {
+        for (auto &part : parts)
+        {
+            retire_part(part);
+        }
+    }
+#endif
+
+    dml::detail::submission_status hardware_device::submit(const descriptor &dsc, std::uint32_t numa_id) noexcept
+    {
+#if defined(__linux__)
+        const auto own_numa_id = (numa_id == std::numeric_limits<decltype(numa_id)>::max()) ? util::get_numa_id() : numa_id;
+
+        auto &dispatcher = dispatcher::hw_dispatcher::get_instance();
+
+        if (dispatcher.is_hw_support())
+        {
+            if (const auto part_size = get_stripe_size(dispatcher, dsc, own_numa_id); part_size != 0u)
+            {
+                return submit_striped(dispatcher, dsc, own_numa_id, part_size);
+            }
+
+            const auto policy = queue_selection.load(std::memory_order_relaxed);
+
+            if (policy == dml::detail::queue_selection::round_robin)
+            {
+                return submit_round_robin(dispatcher, dsc, own_numa_id);
+            }
+
+            return submit_with_policy(dispatcher, dsc, own_numa_id, policy);
+        }
 #else
         static_cast<void>(dsc);
         static_cast<void>(numa_id);
@@ -76,4 +581,126 @@ namespace dml::core
 
         return dml::detail::submission_status::failure;
     }
+
+    void hardware_device::set_queue_selection(dml::detail::queue_selection policy) noexcept
+    {
+#if defined(__linux__)
+        queue_selection.store(policy, std::memory_order_relaxed);
+#else
+        static_cast<void>(policy);
+#endif
+    }
+
+    void hardware_device::set_striping_threshold(std::uint32_t threshold) noexcept
+    {
+#if defined(__linux__)
+        striping_threshold.store(threshold, std::memory_order_relaxed);
+#else
+        static_cast<void>(threshold);
+#endif
+    }
+
+    std::uint32_t hardware_device::queue_count() noexcept
+    {
+        auto count = 0u;
+
+#if defined(__linux__)
+        auto &dispatcher = dispatcher::hw_dispatcher::get_instance();
+
+        if (dispatcher.is_hw_support())
+        {
+            for (const auto &device : dispatcher)
+            {
+                count += device.size();
+            }
+        }
+#endif
+
+        return count;
+    }
+
+    dml::detail::queue_counters hardware_device::get_queue_counters(std::uint32_t index) noexcept
+    {
+#if defined(__linux__)
+        auto &dispatcher = dispatcher::hw_dispatcher::get_instance();
+
+        if (dispatcher.is_hw_support())
+        {
+            auto device_idx = 0u;
+
+            for (const auto &device : dispatcher)
+            {
+                if (index < device.size())
+                {
+                    const auto &queue = *(device.begin() + index);
+
+                    return { device_idx,
+                             index,
+                             queue.priority(),
+                             queue.submissions(),
+                             queue.retries(),
+                             queue.occupancy(),
+                             queue.is_dedicated() };
+                }
+
+                index -= device.size();
+                device_idx++;
+            }
+        }
+#else
+        static_cast<void>(index);
+#endif
+
+        return {};
+    }
+
+    float hardware_device::load() noexcept
+    {
+#if defined(__linux__)
+        auto &dispatcher = dispatcher::hw_dispatcher::get_instance();
+
+        auto occupancy = 0u;
+        auto count     = 0u;
+
+        if (dispatcher.is_hw_support())
+        {
+            for (const auto &device : dispatcher)
+            {
+                for (const auto &queue : device)
+                {
+                    occupancy += queue.occupancy();
+                    count++;
+                }
+            }
+        }
+
+        return (count != 0u) ? static_cast<float>(occupancy) / static_cast<float>(count) : 0.0f;
+#else
+        return 0.0f;
+#endif
+    }
+
+    void hardware_device::retire(const descriptor &dsc) noexcept
+    {
+#if defined(__linux__)
+        if (dispatcher::hw_dispatcher::get_instance().has_dedicated_queues())
+        {
+            static_cast<void>(dispatcher::hw_queue::retire(&get_completion_record(dsc)));
+        }
+#else
+        static_cast<void>(dsc);
+#endif
+    }
+
+    void hardware_device::release(const descriptor &dsc) noexcept
+    {
+#if defined(__linux__)
+        if (dispatcher::hw_dispatcher::get_instance().has_dedicated_queues())
+        {
+            static_cast<void>(dispatcher::hw_queue::retire(&get_completion_record(dsc), true));
+        }
+#else
+        static_cast<void>(dsc);
+#endif
+    }
 }  // namespace dml::core
@@ -12,6 +12,8 @@
 
 #include <algorithm>
 
+#include "hw_emulator.hpp"
+
 #include "legacy_headers/hardware_configuration_driver.h"
 #include "legacy_headers/own_dsa_accel_constants.h"
 
@@ -233,6 +235,47 @@ namespace dml::core::dispatcher
 #endif
     }
 
+    auto hw_device::initialize_emulated_device(hw_emulator &emulator, uint32_t device_idx) noexcept -> dsahw_status_t
+    {
+        const auto &configuration = emulator.get_configuration();
+
+        const auto log2 = [](uint32_t power_of_two) -> uint64_t
+        {
+            auto result = 0u;
+
+            while ((power_of_two >>= 1u) != 0u)
+            {
+                result++;
+            }
+
+            return result;
+        };
+
+        // Block on fault, overlapping copy and both cache controls are supported
+        gen_cap_register_ = 0b1111u;
+        gen_cap_register_ |= log2(configuration.max_transfer_size) << 16u;
+        gen_cap_register_ |= log2(configuration.max_batch_size) << 21u;
+        numa_node_id_  = configuration.numa_id;
+        version_major_ = 1u;
+        version_minor_ = 0u;
+
+        DIAG("emu%u: version: %d.%d\n", device_idx, version_major_, version_minor_);
+        DIAG("emu%u: numa:    %lu\n", device_idx, numa_node_id_);
+        DIAG("emu%u: GENCAP: 0x%016lX\n", device_idx, gen_cap_register_);
+
+        queue_count_ = configuration.queues;
+
+        for (auto queue_idx = 0u; queue_idx < queue_count_; ++queue_idx)
+        {
+            if (DML_STATUS_OK != working_queues_[queue_idx].initialize_emulated_queue(emulator, device_idx, queue_idx))
+            {
+                return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
+            }
+        }
+
+        return DML_STATUS_OK;
+    }
+
     auto hw_device::size() const noexcept -> size_t
     {
         return queue_count_;
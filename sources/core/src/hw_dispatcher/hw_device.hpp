@@ -36,10 +36,14 @@ namespace dml::core::dispatcher
 
         [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> dsahw_status_t;
 
+        [[nodiscard]] auto initialize_emulated_device(hw_emulator &emulator, uint32_t device_idx) noexcept -> dsahw_status_t;
+
         [[nodiscard]] auto size() const noexcept -> size_t;
 
         [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
 
+        [[nodiscard]] auto max_transfer_size() const noexcept -> uint32_t;
+
         [[nodiscard]] auto begin() const noexcept -> queues_container_t::const_iterator;
 
         [[nodiscard]] auto end() const noexcept -> queues_container_t::const_iterator;
@@ -57,8 +61,6 @@ namespace dml::core::dispatcher
 
         auto descriptor_readback_support() const noexcept -> uint8_t;
 
-        auto max_transfer_size() const noexcept -> uint32_t;
-
         auto max_batch_size() const noexcept -> uint32_t;
 
         auto message_size() const noexcept -> uint16_t;
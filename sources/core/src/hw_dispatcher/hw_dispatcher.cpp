@@ -8,6 +8,9 @@
 
 #if defined(__linux__)
 
+#include <algorithm>
+#include <cstdlib>
+
 #include "legacy_headers/libaccel_config.h"
 
 #endif
@@ -28,6 +31,16 @@ namespace dml::core::dispatcher
 #if defined(__linux__)
         hw_init_status_ = hw_dispatcher::initialize_hw();
         hw_support_     = hw_init_status_ == DML_STATUS_OK;
+
+        for (const auto &device : *this)
+        {
+            has_dedicated_queues_ |= std::any_of(device.begin(),
+                                                 device.end(),
+                                                 [](const hw_queue &queue)
+                                                 {
+                                                     return queue.is_dedicated();
+                                                 });
+        }
 #else
         hw_support_ = false;
 #endif
@@ -42,6 +55,11 @@ namespace dml::core::dispatcher
         DIAG("DML version %s\n", "TODO");
         DIAG("Struct size: %lu B\n", sizeof(device_container_t));
 
+        if (const auto *options = std::getenv("DML_HW_EMULATION"); options != nullptr)
+        {
+            return initialize_emulated_hw(options);
+        }
+
         dsahw_status_t status = dsa_initialize_accelerator_driver(&hw_driver_);
         DML_HWSTS_RET(status != DML_STATUS_OK, status);
 
@@ -76,11 +94,33 @@ namespace dml::core::dispatcher
 
         return DML_STATUS_OK;
     }
+
+    auto hw_dispatcher::initialize_emulated_hw(const char *options) noexcept -> dsahw_status_t
+    {
+        DIAG("emulating devices: %s\n", options);
+
+        emulator_ = std::make_unique<hw_emulator>(emulator_configuration::parse(options));
+
+        const auto count = emulator_->get_configuration().devices;
+
+        for (auto device_idx = 0u; device_idx < count; ++device_idx)
+        {
+            auto status = devices_[device_idx].initialize_emulated_device(*emulator_, device_idx);
+            DML_HWSTS_RET(status != DML_STATUS_OK, status);
+        }
+
+        device_count_ = count;
+
+        return DML_STATUS_OK;
+    }
 #endif
 
     hw_dispatcher::~hw_dispatcher() noexcept
     {
 #if defined(__linux__)
+        // Accepted descriptors are finished before the queues are gone
+        emulator_.reset();
+
         // Variables
         auto *context_ptr = hw_context_.get_driver_context_ptr();
 
@@ -146,6 +186,11 @@ namespace dml::core::dispatcher
         return devices_[idx % device_count_];
     }
 
+    auto hw_dispatcher::has_dedicated_queues() const noexcept -> bool
+    {
+        return has_dedicated_queues_;
+    }
+
     void hw_dispatcher::hw_context::set_driver_context_ptr(accfg_ctx *driver_context_ptr) noexcept
     {
         driver_context_ptr_ = driver_context_ptr;
@@ -9,9 +9,11 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
 
 #include "dml/dmldefs.h"
 #include "hw_device.hpp"
+#include "hw_emulator.hpp"
 
 #if defined(__linux__)
 #include "legacy_headers/hardware_configuration_driver.h"
@@ -66,6 +68,8 @@ namespace dml::core::dispatcher
 
         [[nodiscard]] auto device(size_t idx) const noexcept -> const hw_device &;
 
+        [[nodiscard]] auto has_dedicated_queues() const noexcept -> bool;
+
 #endif
 
         virtual ~hw_dispatcher() noexcept;
@@ -76,11 +80,16 @@ namespace dml::core::dispatcher
 #if defined(__linux__)
         auto initialize_hw() noexcept -> dsahw_status_t;
 
+        auto initialize_emulated_hw(const char *options) noexcept -> dsahw_status_t;
+
     private:
         hw_context         hw_context_;
         hw_driver_t        hw_driver_{};
         device_container_t devices_{};
         size_t             device_count_ = 0;
+        bool               has_dedicated_queues_ = false;
+
+        std::unique_ptr<hw_emulator> emulator_; /**< Stands in for the devices if DML_HW_EMULATION is set */
 #endif
 
         bool hw_support_;
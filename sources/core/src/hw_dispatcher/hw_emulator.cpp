@@ -0,0 +1,503 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined(__linux__)
+
+#include "hw_emulator.hpp"
+
+#include <core/completion_record_views.hpp>
+#include <core/descriptor_views.hpp>
+#include <core/device.hpp>
+#include <core/operations.hpp>
+#include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "legacy_headers/own_dsa_accel_constants.h"
+#include "numa.hpp"
+
+namespace dml::core::dispatcher
+{
+    /**
+     * @brief Bit of the completion status that is set if the page fault happened on write
+     */
+    static constexpr status_t write_fault_bit = 0x80u;
+
+    static auto round_down_to_power_of_two(uint32_t value) noexcept -> uint32_t
+    {
+        auto result = 1u;
+
+        while (result <= value / 2u)
+        {
+            result *= 2u;
+        }
+
+        return result;
+    }
+
+    auto emulator_configuration::parse(const char *options) noexcept -> emulator_configuration
+    {
+        static constexpr struct
+        {
+            const char *name;
+            uint32_t emulator_configuration::*field;
+        } fields[] = { { "devices", &emulator_configuration::devices },
+                       { "queues", &emulator_configuration::queues },
+                       { "depth", &emulator_configuration::depth },
+                       { "engines", &emulator_configuration::engines },
+                       { "numa", &emulator_configuration::numa_id },
+                       { "max_transfer", &emulator_configuration::max_transfer_size },
+                       { "max_batch", &emulator_configuration::max_batch_size },
+                       { "retry", &emulator_configuration::retry_interval },
+                       { "page_fault", &emulator_configuration::page_fault_interval },
+                       { "latency", &emulator_configuration::latency },
+                       { "dedicated", &emulator_configuration::dedicated } };
+
+        auto configuration    = emulator_configuration {};
+        configuration.numa_id = util::get_numa_id();
+
+        while (options != nullptr && *options != '\0')
+        {
+            char     name[16] = {};
+            uint32_t value    = 0u;
+
+            if (std::sscanf(options, "%15[^=,]=%u", name, &value) == 2)
+            {
+                for (const auto &field : fields)
+                {
+                    if (std::strcmp(field.name, name) == 0)
+                    {
+                        configuration.*field.field = value;
+                    }
+                }
+            }
+
+            options = std::strchr(options, ',');
+            options = (options != nullptr) ? options + 1u : nullptr;
+        }
+
+        // Same limits as for the real devices
+        configuration.devices           = std::clamp(configuration.devices, 1u, MAX_DEVICE_COUNT);
+        configuration.queues            = std::clamp(configuration.queues, 1u, MAX_WORK_QUEUE_COUNT);
+        configuration.dedicated         = std::min(configuration.dedicated, configuration.queues);
+        configuration.depth             = std::max(configuration.depth, 1u);
+        configuration.engines           = std::max(configuration.engines, 1u);
+        configuration.max_transfer_size = round_down_to_power_of_two(std::max(configuration.max_transfer_size, 1u));
+        configuration.max_batch_size    = round_down_to_power_of_two(std::clamp(configuration.max_batch_size, 2u, 1u << 15u));
+
+        return configuration;
+    }
+
+    auto emulator_configuration::is_dedicated(uint32_t queue_idx) const noexcept -> bool
+    {
+        return queue_idx >= queues - dedicated;
+    }
+
+    hw_emulator::hw_emulator(const emulator_configuration &configuration) noexcept
+        : configuration_(configuration)
+    {
+        devices_.reserve(configuration_.devices);
+
+        for (auto device_idx = 0u; device_idx < configuration_.devices; ++device_idx)
+        {
+            auto &owner = *devices_.emplace_back(std::make_unique<device>());
+
+            owner.queues.resize(configuration_.queues);
+
+            for (auto &queue : owner.queues)
+            {
+                queue.ring.resize(configuration_.depth);
+            }
+
+            owner.engines.reserve(configuration_.engines);
+
+            for (auto engine_idx = 0u; engine_idx < configuration_.engines; ++engine_idx)
+            {
+                owner.engines.emplace_back(&hw_emulator::run, this, std::ref(owner));
+            }
+        }
+    }
+
+    hw_emulator::~hw_emulator() noexcept
+    {
+        for (auto &owner : devices_)
+        {
+            {
+                auto lock   = std::lock_guard(owner->mutex);
+                owner->stop = true;
+            }
+
+            owner->not_empty.notify_all();
+
+            for (auto &engine : owner->engines)
+            {
+                engine.join();
+            }
+        }
+    }
+
+    auto hw_emulator::get_configuration() const noexcept -> const emulator_configuration &
+    {
+        return configuration_;
+    }
+
+    auto hw_emulator::enqueue(uint32_t device_idx, uint32_t queue_idx, const dsahw_descriptor_t *desc_ptr) noexcept
+        -> dsahw_status_t
+    {
+        const auto retry_interval = configuration_.retry_interval;
+        const auto is_dedicated   = configuration_.is_dedicated(queue_idx);
+
+        if (retry_interval != 0u && !is_dedicated && (submissions_.fetch_add(1u, std::memory_order_relaxed) + 1u) % retry_interval == 0u)
+        {
+            return DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+        }
+
+        auto &owner = *devices_[device_idx];
+
+        {
+            auto  lock  = std::lock_guard(owner.mutex);
+            auto &queue = owner.queues[queue_idx];
+
+            // Busy shared work queue rejects the descriptor, the submitter decides whether to retry
+            if (queue.count == queue.ring.size())
+            {
+                // Dedicated work queue has no way to report it, the descriptor is lost
+                return is_dedicated ? DML_STATUS_OK : DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+            }
+
+            std::memcpy(queue.ring[(queue.head + queue.count) % queue.ring.size()].bytes, desc_ptr->bytes, sizeof(desc_ptr->bytes));
+
+            queue.count++;
+            owner.pending++;
+        }
+
+        owner.not_empty.notify_one();
+
+        return DML_STATUS_OK;
+    }
+
+    auto hw_emulator::occupancy(uint32_t device_idx, uint32_t queue_idx) noexcept -> uint32_t
+    {
+        auto &owner = *devices_[device_idx];
+        auto  lock  = std::lock_guard(owner.mutex);
+
+        return owner.queues[queue_idx].count;
+    }
+
+    void hw_emulator::run(device &owner) noexcept
+    {
+        auto lock = std::unique_lock(owner.mutex);
+
+        while (true)
+        {
+            owner.not_empty.wait(lock,
+                                 [&owner]
+                                 {
+                                     return owner.stop || owner.pending != 0u;
+                                 });
+
+            // Accepted descriptors are finished before stopping
+            if (owner.pending == 0u)
+            {
+                return;
+            }
+
+            while (owner.queues[owner.next_queue].count == 0u)
+            {
+                owner.next_queue = (owner.next_queue + 1u) % owner.queues.size();
+            }
+
+            auto &queue = owner.queues[owner.next_queue];
+            auto  dsc   = queue.ring[queue.head];
+
+            queue.head = (queue.head + 1u) % queue.ring.size();
+            queue.count--;
+            owner.pending--;
+            owner.next_queue = (owner.next_queue + 1u) % owner.queues.size();
+
+            lock.unlock();
+            execute(dsc);
+            lock.lock();
+        }
+    }
+
+    static void complete(completion_record &record, status_t status) noexcept
+    {
+        // Status is the last thing waiters see
+        std::atomic_thread_fence(std::memory_order_release);
+        any_completion_record(record).status() = status;
+    }
+
+    static auto check_limits(descriptor &dsc, const emulator_configuration &configuration) noexcept -> status_t
+    {
+        auto view = any_descriptor(dsc);
+
+        const auto is_block_on_fault = (view.flags() & to_underlying(dml::detail::flag::block_on_fault)) != 0u;
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::nop:
+            case operation::drain:
+                // Block On Fault is reserved for operations that don't access memory
+                return is_block_on_fault ? to_underlying(dml::detail::execution_status::flag_error) : 0u;
+            case operation::batch:
+                if (is_block_on_fault)
+                {
+                    return to_underlying(dml::detail::execution_status::flag_error);
+                }
+
+                return (make_view<operation::batch>(dsc).descriptors_count() > configuration.max_batch_size)
+                           ? to_underlying(dml::detail::execution_status::descriptor_count_error)
+                           : 0u;
+            default:
+                return (view.transfer_size() > configuration.max_transfer_size)
+                           ? to_underlying(dml::detail::execution_status::invalid_transfer_size_error)
+                           : 0u;
+        }
+    }
+
+    /**
+     * @brief Returns the status of a page fault for operations that can be continued from the completion record
+     */
+    static auto get_page_fault_status(descriptor &dsc) noexcept -> status_t
+    {
+        constexpr auto page_fault_status = to_underlying(dml::detail::execution_status::page_fault_during_processing);
+
+        auto view = any_descriptor(dsc);
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::mem_move:
+            {
+                // Backward copy of overlapping regions would be continued from the other end
+                const auto src = view.source_address();
+                const auto dst = view.destination_address();
+
+                return (dst > src && dst < src + view.transfer_size()) ? 0u : page_fault_status;
+            }
+            case operation::dualcast:
+            case operation::crc:
+            case operation::copy_crc:
+                return page_fault_status;
+            case operation::fill:
+            case operation::cache_flush:
+                return page_fault_status | write_fault_bit;
+            default:
+                return 0u;
+        }
+    }
+
+    /**
+     * @brief Returns offset of the first page in the region that isn't resident, or the size if all pages are
+     *
+     * The device faults on pages that aren't present, e.g. after MADV_DONTNEED, where the CPU would fault them in.
+     */
+    static auto find_absent_page(address_t address, transfer_size_t size) noexcept -> transfer_size_t
+    {
+        if (size == 0u)
+        {
+            return size;
+        }
+
+        const auto page_size = static_cast<address_t>(getpagesize());
+        const auto begin     = address & ~(page_size - 1u);
+        const auto end       = (address + size + page_size - 1u) & ~(page_size - 1u);
+
+        auto residency = std::vector<unsigned char>((end - begin) / page_size);
+
+        // Region that isn't mapped is left to the CPU fault
+        if (mincore(reinterpret_cast<void *>(begin), end - begin, residency.data()) != 0)
+        {
+            return size;
+        }
+
+        for (size_t page_idx = 0u; page_idx < residency.size(); ++page_idx)
+        {
+            if ((residency[page_idx] & 1u) == 0u)
+            {
+                return static_cast<transfer_size_t>(std::max(begin + page_idx * page_size, address) - address);
+            }
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Looks for a page fault the device would stop at
+     *
+     * @return Fault status with bytes completed and fault address in the record, or 0 if the descriptor can run
+     */
+    static auto find_page_fault(descriptor &dsc, completion_record &record) noexcept -> status_t
+    {
+        constexpr auto page_fault_status = to_underlying(dml::detail::execution_status::page_fault_during_processing);
+
+        struct region
+        {
+            address_t       address;
+            transfer_size_t size;
+            bool            is_write;
+        };
+
+        auto view = any_descriptor(dsc);
+
+        const auto src  = view.source_address();
+        const auto dst  = view.destination_address();
+        const auto size = view.transfer_size();
+
+        // Regions are listed in the order the device accesses them
+        region regions[3] = {};
+        auto   count      = 0u;
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::mem_move:
+            case operation::copy_crc:
+                regions[count++] = { src, size, false };
+                regions[count++] = { dst, size, true };
+                break;
+            case operation::fill:
+            case operation::cache_flush:
+                regions[count++] = { dst, size, true };
+                break;
+            case operation::compare:
+                regions[count++] = { src, size, false };
+                regions[count++] = { dst, size, false };
+                break;
+            case operation::compare_pattern:
+            case operation::crc:
+                regions[count++] = { src, size, false };
+                break;
+            case operation::create_delta:
+            {
+                auto delta = make_view<operation::create_delta>(dsc);
+
+                regions[count++] = { src, size, false };
+                regions[count++] = { dst, size, false };
+                regions[count++] = { delta.delta_record_address(), delta.maximum_delta_record_size(), true };
+                break;
+            }
+            case operation::apply_delta:
+                regions[count++] = { src, make_view<operation::apply_delta>(dsc).delta_record_size(), false };
+                regions[count++] = { dst, size, true };
+                break;
+            case operation::dualcast:
+                regions[count++] = { src, size, false };
+                regions[count++] = { dst, size, true };
+                regions[count++] = { make_view<operation::dualcast>(dsc).destination_2_address(), size, true };
+                break;
+            default:
+                return 0u;
+        }
+
+        // Size of the fault region holds its offset
+        auto fault = region { 0u, ~transfer_size_t(0u), false };
+
+        for (auto idx = 0u; idx < count; ++idx)
+        {
+            const auto offset = find_absent_page(regions[idx].address, regions[idx].size);
+
+            if (offset < regions[idx].size && offset < fault.size)
+            {
+                fault = { regions[idx].address + offset, offset, regions[idx].is_write };
+            }
+        }
+
+        if (fault.size == ~transfer_size_t(0u))
+        {
+            return 0u;
+        }
+
+        // Only operations with a well-defined prefix report progress
+        const auto bytes_completed = (get_page_fault_status(dsc) != 0u) ? fault.size & ~63u : 0u;
+
+        any_completion_record(record).bytes_completed() = bytes_completed;
+        any_completion_record(record).fault_address()   = fault.address;
+
+        return page_fault_status | (fault.is_write ? write_fault_bit : 0u);
+    }
+
+    void hw_emulator::execute(descriptor &dsc) noexcept
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(configuration_.latency);
+
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        auto &record = get_completion_record(dsc);
+
+        if (auto status = check_limits(dsc, configuration_); status != 0u)
+        {
+            complete(record, status);
+            return;
+        }
+
+        auto view = any_descriptor(dsc);
+
+        // The device resolves faults itself if the descriptor blocks on them
+        if (view.flags() & to_underlying(dml::detail::flag::block_on_fault))
+        {
+            static_cast<void>(software_device().submit(dsc));
+            return;
+        }
+
+        auto status = find_page_fault(dsc, record);
+
+        const auto page_fault_interval = configuration_.page_fault_interval;
+
+        if (status == 0u && page_fault_interval != 0u && get_page_fault_status(dsc) != 0u &&
+            (executions_.fetch_add(1u, std::memory_order_relaxed) + 1u) % page_fault_interval == 0u)
+        {
+            // Bytes before the fault are a whole number of cache lines, so patterns and CRC stay continuous
+            const auto bytes_completed = (view.transfer_size() / 2u) & ~63u;
+            status                     = get_page_fault_status(dsc);
+
+            const auto fault_base = (status & write_fault_bit) ? view.destination_address() : view.source_address();
+
+            any_completion_record(record).bytes_completed() = bytes_completed;
+            any_completion_record(record).fault_address()   = fault_base + bytes_completed;
+        }
+
+        if (status == 0u)
+        {
+            static_cast<void>(software_device().submit(dsc));
+            return;
+        }
+
+        const auto bytes_completed = any_completion_record(record).bytes_completed();
+
+        if (bytes_completed != 0u)
+        {
+            auto partial        = dsc;
+            auto partial_record = completion_record();
+            auto partial_view   = any_descriptor(partial);
+
+            partial_view.transfer_size()             = bytes_completed;
+            partial_view.completion_record_address() = reinterpret_cast<address_t>(&partial_record);
+
+            static_cast<void>(software_device().submit(partial));
+
+            // Operation-specific fields, e.g. CRC of the completed part, are kept
+            constexpr auto fields_offset = 16u;
+            std::memcpy(&record.bytes[fields_offset], &partial_record.bytes[fields_offset], sizeof(record.bytes) - fields_offset);
+        }
+
+        complete(record, status);
+    }
+
+}  // namespace dml::core::dispatcher
+
+#endif
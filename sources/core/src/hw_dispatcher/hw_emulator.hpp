@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
+#define DML_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "dml/detail/common/types.hpp"
+#include "dml/dmldefs.h"
+
+#if defined(__linux__)
+
+#include "legacy_headers/hardware_definitions.h"
+
+namespace dml::core::dispatcher
+{
+    /**
+     * @brief Topology and behavior of emulated devices
+     *
+     * Parsed from a comma-separated list of "<name>=<value>" options, e.g. "devices=2,queues=4,retry=16".
+     * Unknown and malformed options are ignored.
+     */
+    struct emulator_configuration
+    {
+        uint32_t devices             = 1u;         /**< Number of devices, option "devices" */
+        uint32_t queues              = 1u;         /**< Work queues of each device, option "queues" */
+        uint32_t depth               = 32u;        /**< Descriptors a work queue holds, option "depth" */
+        uint32_t engines             = 1u;         /**< Worker threads of each device, option "engines" */
+        uint32_t numa_id             = 0u;         /**< NUMA node of all devices, option "numa", the current node by default */
+        uint32_t max_transfer_size   = 1u << 31u;  /**< Rounded down to a power of two, option "max_transfer" */
+        uint32_t max_batch_size      = 1u << 10u;  /**< Rounded down to a power of two, option "max_batch" */
+        uint32_t retry_interval      = 0u;         /**< Every N-th submission is rejected, option "retry", zero disables */
+        uint32_t page_fault_interval = 0u;         /**< Every N-th descriptor stops halfway, option "page_fault", zero disables */
+        uint32_t latency             = 0u;         /**< Nanoseconds each descriptor takes on top of the work, option "latency" */
+        uint32_t dedicated           = 0u;         /**< Last N work queues of each device are dedicated, option "dedicated" */
+
+        [[nodiscard]] static auto parse(const char *options) noexcept -> emulator_configuration;
+
+        [[nodiscard]] auto is_dedicated(uint32_t queue_idx) const noexcept -> bool;
+    };
+
+    /**
+     * @brief Software stand-in for DSA devices, used when the DML_HW_EMULATION environment variable is set
+     *
+     * Work queues are bounded rings, a submission to a full queue is rejected the same way ENQCMD is rejected by a busy
+     * shared work queue, or dropped the same way a MOVDIR64B write to a full dedicated work queue is. Engines of a device take descriptors from its queues round robin and execute them with the
+     * software kernels, writing real completion records. Descriptors without the Block On Fault flag may stop halfway
+     * with a page fault status, so continuation of partially completed operations can be exercised.
+     */
+    class hw_emulator final
+    {
+    public:
+        explicit hw_emulator(const emulator_configuration &configuration) noexcept;
+
+        hw_emulator(const hw_emulator &) = delete;
+
+        auto operator=(const hw_emulator &) -> hw_emulator & = delete;
+
+        ~hw_emulator() noexcept;
+
+        [[nodiscard]] auto get_configuration() const noexcept -> const emulator_configuration &;
+
+        [[nodiscard]] auto enqueue(uint32_t device_idx, uint32_t queue_idx, const dsahw_descriptor_t *desc_ptr) noexcept
+            -> dsahw_status_t;
+
+        [[nodiscard]] auto occupancy(uint32_t device_idx, uint32_t queue_idx) noexcept -> uint32_t;
+
+    private:
+        struct work_queue
+        {
+            std::vector<dml::detail::descriptor> ring;       /**< Accepted descriptors */
+            uint32_t                             head  = 0u; /**< Next descriptor to execute */
+            uint32_t                             count = 0u; /**< Number of accepted descriptors */
+        };
+
+        struct device
+        {
+            std::mutex               mutex;
+            std::condition_variable  not_empty;
+            std::vector<work_queue>  queues;
+            std::vector<std::thread> engines;
+            uint32_t                 pending    = 0u; /**< Descriptors in all queues */
+            uint32_t                 next_queue = 0u; /**< Queue the next engine starts looking from */
+            bool                     stop       = false;
+        };
+
+        void run(device &owner) noexcept;
+
+        void execute(dml::detail::descriptor &dsc) noexcept;
+
+        emulator_configuration               configuration_;
+        std::vector<std::unique_ptr<device>> devices_;
+        std::atomic<uint64_t>                submissions_ = 0u; /**< Counter for rejected submissions */
+        std::atomic<uint64_t>                executions_  = 0u; /**< Counter for page faults */
+    };
+
+}  // namespace dml::core::dispatcher
+
+#endif
+#endif  //DML_MIDDLE_LAYER_DISPATCHER_HW_EMULATOR_HPP_
@@ -7,6 +7,10 @@
 #if defined(__linux__)
 
 #include <fcntl.h>
+#include <x86intrin.h>
+
+#include <array>
+#include <cstring>
 
 #if defined(__linux__)
 
@@ -14,6 +18,7 @@
 
 #endif
 
+#include "hw_emulator.hpp"
 #include "hw_queue.hpp"
 #include "legacy_headers/hardware_configuration_driver.h"
 #include "legacy_headers/own_dsa_accel_constants.h"
@@ -28,14 +33,118 @@
 
 namespace dml::core::dispatcher
 {
+    /**
+     * @brief Dedicated work queues owned by a thread, other threads can take them after it exits
+     */
+    class producer final
+    {
+    public:
+        ~producer() noexcept
+        {
+            for (auto idx = 0u; idx < count_; ++idx)
+            {
+                auto token = this->token();
+                owners_[idx]->compare_exchange_strong(token, 0u);
+            }
+        }
+
+        [[nodiscard]] auto token() const noexcept -> uintptr_t
+        {
+            return reinterpret_cast<uintptr_t>(this);
+        }
+
+        void own(std::atomic<uintptr_t> &owner) noexcept
+        {
+            owners_[count_++] = &owner;
+        }
+
+    private:
+        std::atomic<uintptr_t> *owners_[MAX_DEVICE_COUNT * MAX_WORK_QUEUE_COUNT] = {};
+        uint32_t                count_ = 0u;
+    };
+
+    static thread_local producer this_producer;
+
+    hw_queue::producer_state::producer_state(uint32_t size) noexcept
+        : credits(size),
+          size(size)
+    {
+    }
+
+    /**
+     * @brief Completion record of a descriptor in a dedicated work queue, with the credits of the queue
+     */
+    struct pending_record
+    {
+        std::atomic<const void *>            record  = nullptr;
+        std::atomic<std::atomic<uint32_t> *> credits = nullptr; /**< Written before the record is, read while it is set */
+    };
+
+    /**
+     * @brief A record goes to one of a few entries after the one its address maps to
+     *
+     * The table has room for several times the descriptors all dedicated queues hold, so it is rarely full.
+     * A descriptor that finds no free entry is rejected, like one sent to a full queue.
+     */
+    static constexpr auto pending_records_bits  = 12u;
+    static constexpr auto pending_records_count = 1u << pending_records_bits;
+    static constexpr auto pending_records_probe = 8u;
+
+    /**
+     * @brief Taken by a submission before it writes the credits
+     */
+    static const auto claimed_record = reinterpret_cast<const void *>(uintptr_t(1u));
+
+    static std::array<pending_record, pending_records_count> pending_records;
+
+    static auto get_pending_index(const void *record_ptr) noexcept -> uint32_t
+    {
+        // Completion records are 32-byte aligned
+        const auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(record_ptr) >> 5u);
+
+        return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> (64u - pending_records_bits));
+    }
+
+    static auto add_pending_record(const void *record_ptr, std::atomic<uint32_t> &credits) noexcept -> pending_record *
+    {
+        const auto index = get_pending_index(record_ptr);
+
+        for (auto probe = 0u; probe < pending_records_probe; ++probe)
+        {
+            auto &entry    = pending_records[(index + probe) % pending_records_count];
+            auto  expected = static_cast<const void *>(nullptr);
+
+            if (entry.record.load(std::memory_order_relaxed) == nullptr &&
+                entry.record.compare_exchange_strong(expected, claimed_record, std::memory_order_acquire))
+            {
+                entry.credits.store(&credits, std::memory_order_relaxed);
+                entry.record.store(record_ptr, std::memory_order_release);
+
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
     hw_queue::hw_queue(hw_queue &&other) noexcept
     {
         version_       = other.version_;
         priority_      = other.priority_;
+        memory_type_   = other.memory_type_;
         portal_mask_   = other.portal_mask_;
         portal_ptr_    = other.portal_ptr_;
         portal_offset_ = 0;
 
+        emulator_            = other.emulator_;
+        emulated_device_idx_ = other.emulated_device_idx_;
+        emulated_queue_idx_  = other.emulated_queue_idx_;
+
+        counters_.submissions = other.counters_.submissions.load();
+        counters_.retries     = other.counters_.retries.load();
+        counters_.last_retry  = other.counters_.last_retry.load();
+        dedicated_            = std::move(other.dedicated_);
+
         other.portal_ptr_ = nullptr;
     }
 
@@ -44,10 +153,20 @@ namespace dml::core::dispatcher
         if(&other != this){
             version_       = other.version_;
             priority_      = other.priority_;
+            memory_type_   = other.memory_type_;
             portal_mask_   = other.portal_mask_;
             portal_ptr_    = other.portal_ptr_;
             portal_offset_ = 0;
-            
+
+            emulator_            = other.emulator_;
+            emulated_device_idx_ = other.emulated_device_idx_;
+            emulated_queue_idx_  = other.emulated_queue_idx_;
+
+            counters_.submissions = other.counters_.submissions.load();
+            counters_.retries     = other.counters_.retries.load();
+            counters_.last_retry  = other.counters_.last_retry.load();
+            dedicated_            = std::move(other.dedicated_);
+
             other.portal_ptr_ = nullptr;
         }
 
@@ -84,21 +203,151 @@ namespace dml::core::dispatcher
     auto hw_queue::enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t
     {
 #if defined(__linux__)
-        uint8_t retry = 0u;
+        auto status = static_cast<dsahw_status_t>(DML_STATUS_OK);
 
-        void *current_place_ptr = get_portal_ptr();
-        asm volatile("sfence\t\n"
-                     ".byte 0xf2, 0x0f, 0x38, 0xf8, 0x02\t\n"
-                     "setz %0\t\n"
-                     : "=r"(retry)
-                     : "a"(current_place_ptr), "d"(desc_ptr));
+        if (dedicated_ != nullptr)
+        {
+            status = enqueue_dedicated(desc_ptr);
+        }
+        else if (emulator_ != nullptr)
+        {
+            status = emulator_->enqueue(emulated_device_idx_, emulated_queue_idx_, desc_ptr);
+        }
+        else
+        {
+            uint8_t retry = 0u;
+
+            void *current_place_ptr = get_portal_ptr();
+            asm volatile("sfence\t\n"
+                         ".byte 0xf2, 0x0f, 0x38, 0xf8, 0x02\t\n"
+                         "setz %0\t\n"
+                         : "=r"(retry)
+                         : "a"(current_place_ptr), "d"(desc_ptr));
+
+            status = static_cast<dsahw_status_t>(retry);
+        }
+
+        if (DML_STATUS_OK == status)
+        {
+            counters_.submissions.fetch_add(1u, std::memory_order_relaxed);
+        }
+        else if (DML_STATUS_WORK_QUEUES_NOT_AVAILABLE != status)
+        {
+            counters_.retries.fetch_add(1u, std::memory_order_relaxed);
+            counters_.last_retry.store(__rdtsc(), std::memory_order_relaxed);
+        }
 
-        return static_cast<dsahw_status_t>(retry);
+        return status;
 #else
         return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
 #endif
     }
 
+    auto hw_queue::enqueue_dedicated(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t
+    {
+        constexpr auto completion_record_offset = 8u;
+
+        auto &state = *dedicated_;
+        auto  owner = state.owner.load(std::memory_order_acquire);
+
+        if (owner != this_producer.token())
+        {
+            // The first thread that submits to a free queue becomes its producer
+            if (owner != 0u || !state.owner.compare_exchange_strong(owner, this_producer.token()))
+            {
+                return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
+            }
+
+            this_producer.own(state.owner);
+        }
+
+        if (state.credits.load(std::memory_order_acquire) == 0u)
+        {
+            return DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+        }
+
+        const void *record_ptr = nullptr;
+        std::memcpy(&record_ptr, &desc_ptr->bytes[completion_record_offset], sizeof(record_ptr));
+
+        // The record is known before the descriptor can complete
+        auto *entry = add_pending_record(record_ptr, state.credits);
+
+        if (entry == nullptr)
+        {
+            return DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+        }
+
+        // Only the producer takes credits
+        state.credits.fetch_sub(1u, std::memory_order_relaxed);
+
+        if (emulator_ != nullptr)
+        {
+            const auto status = emulator_->enqueue(emulated_device_idx_, emulated_queue_idx_, desc_ptr);
+
+            if (status != DML_STATUS_OK)
+            {
+                entry->record.store(nullptr, std::memory_order_relaxed);
+                state.credits.fetch_add(1u, std::memory_order_release);
+            }
+
+            return status;
+        }
+
+        void *current_place_ptr = get_portal_ptr();
+        asm volatile("sfence\t\n"
+                     ".byte 0x66, 0x0f, 0x38, 0xf8, 0x02\t\n"
+                     :
+                     : "a"(current_place_ptr), "d"(desc_ptr)
+                     : "memory");
+
+        return DML_STATUS_OK;
+    }
+
+    auto hw_queue::retire(const void *record_ptr, bool wait) noexcept -> bool
+    {
+        // Descriptors that were never submitted have no record, free entries have none either
+        if (record_ptr == nullptr)
+        {
+            return false;
+        }
+
+        const auto index = get_pending_index(record_ptr);
+
+        for (auto probe = 0u; probe < pending_records_probe; ++probe)
+        {
+            auto &entry = pending_records[(index + probe) % pending_records_count];
+
+            if (entry.record.load(std::memory_order_acquire) != record_ptr)
+            {
+                continue;
+            }
+
+            // The entry is reused once the record is cleared, so the credits are taken first
+            auto *credits = entry.credits.load(std::memory_order_relaxed);
+
+            if (wait)
+            {
+                const volatile auto *status = static_cast<const volatile uint8_t *>(record_ptr);
+
+                while (*status == 0u)
+                {
+                    _mm_pause();
+                }
+            }
+
+            auto expected = record_ptr;
+
+            if (entry.record.compare_exchange_strong(expected, nullptr))
+            {
+                credits->fetch_add(1u, std::memory_order_release);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> dsahw_status_t
     {
 #if defined(__linux__)
@@ -114,7 +363,9 @@ namespace dml::core::dispatcher
             return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
         }
 
-        if (ACCFG_WQ_SHARED != dsa_work_queue_get_mode(work_queue_ptr))
+        const auto mode = dsa_work_queue_get_mode(work_queue_ptr);
+
+        if (ACCFG_WQ_SHARED != mode && ACCFG_WQ_DEDICATED != mode)
         {
             DIAG("     %7s: UNSUPPORTED\n", work_queue_dev_name);
             return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
@@ -170,6 +421,21 @@ namespace dml::core::dispatcher
         DIAG("     %7s: memtype:     %d\n", work_queue_dev_name, static_cast<int>(memory_type_));
 #endif
 
+        if (ACCFG_WQ_DEDICATED == mode)
+        {
+            const uint32_t size = dsa_work_queue_get_size(work_queue_ptr);
+
+            DIAG("     %7s: dedicated, size: %u\n", work_queue_dev_name, size);
+
+            if (size == 0u)
+            {
+                munmap(region_ptr, 0x1000u);
+                return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
+            }
+
+            dedicated_ = std::make_unique<producer_state>(size);
+        }
+
         hw_queue::set_portal_ptr(region_ptr);
 
         return DML_STATUS_OK;
@@ -178,6 +444,29 @@ namespace dml::core::dispatcher
 #endif
     }
 
+    auto hw_queue::initialize_emulated_queue(hw_emulator &emulator, uint32_t device_idx, uint32_t queue_idx) noexcept
+        -> dsahw_status_t
+    {
+        const auto &configuration = emulator.get_configuration();
+
+        emulator_            = &emulator;
+        emulated_device_idx_ = device_idx;
+        emulated_queue_idx_  = queue_idx;
+
+        if (configuration.is_dedicated(queue_idx))
+        {
+            dedicated_ = std::make_unique<producer_state>(configuration.depth);
+        }
+
+        DIAG("     emulated wq%u.%u: %s, depth: %u\n",
+             device_idx,
+             queue_idx,
+             is_dedicated() ? "dedicated" : "shared",
+             configuration.depth);
+
+        return DML_STATUS_OK;
+    }
+
     auto hw_queue::priority() const noexcept -> int32_t
     {
         return priority_;
@@ -188,6 +477,37 @@ namespace dml::core::dispatcher
         return memory_type_;
     }
 
+    auto hw_queue::submissions() const noexcept -> uint64_t
+    {
+        return counters_.submissions.load(std::memory_order_relaxed);
+    }
+
+    auto hw_queue::retries() const noexcept -> uint64_t
+    {
+        return counters_.retries.load(std::memory_order_relaxed);
+    }
+
+    auto hw_queue::last_retry() const noexcept -> uint64_t
+    {
+        return counters_.last_retry.load(std::memory_order_relaxed);
+    }
+
+    auto hw_queue::occupancy() const noexcept -> uint32_t
+    {
+        if (dedicated_ != nullptr)
+        {
+            return dedicated_->size - dedicated_->credits.load(std::memory_order_relaxed);
+        }
+
+        // ENQCMD reports only that a shared queue is full
+        return (emulator_ != nullptr) ? emulator_->occupancy(emulated_device_idx_, emulated_queue_idx_) : 0u;
+    }
+
+    auto hw_queue::is_dedicated() const noexcept -> bool
+    {
+        return dedicated_ != nullptr;
+    }
+
 }  // namespace dml::core::dispatcher
 
 #endif
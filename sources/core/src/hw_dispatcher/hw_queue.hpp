@@ -8,6 +8,8 @@
 #define DML_MIDDLE_LAYER_DISPATCHER_HW_QUEUE_HPP_
 
 #include <atomic>
+#include <memory>
+#include <vector>
 
 #include "dml/dmldefs.h"
 
@@ -17,6 +19,7 @@
 
 namespace dml::core::dispatcher
 {
+    class hw_emulator;
 
     class hw_queue
     {
@@ -41,6 +44,8 @@ namespace dml::core::dispatcher
 
         auto initialize_new_queue(descriptor_t *wq_descriptor_ptr) noexcept -> dsahw_status_t;
 
+        auto initialize_emulated_queue(hw_emulator &emulator, uint32_t device_idx, uint32_t queue_idx) noexcept -> dsahw_status_t;
+
         [[nodiscard]] auto get_portal_ptr() const noexcept -> void *;
 
         [[nodiscard]] auto enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
@@ -49,17 +54,69 @@ namespace dml::core::dispatcher
 
         [[nodiscard]] auto memory_type() const noexcept -> supported_memory_type;
 
+        [[nodiscard]] auto submissions() const noexcept -> uint64_t;
+
+        [[nodiscard]] auto retries() const noexcept -> uint64_t;
+
+        [[nodiscard]] auto last_retry() const noexcept -> uint64_t;
+
+        [[nodiscard]] auto occupancy() const noexcept -> uint32_t;
+
+        [[nodiscard]] auto is_dedicated() const noexcept -> bool;
+
+        /**
+         * @brief Returns the credit of the dedicated queue the record was submitted to, false if it isn't waiting for one
+         *
+         * Waits for the completion record first if asked, otherwise the descriptor must have completed.
+         */
+        static auto retire(const void *record_ptr, bool wait = false) noexcept -> bool;
+
         void set_portal_ptr(void *portal_ptr) noexcept;
 
         virtual ~hw_queue() noexcept;
 
     private:
-        uint32_t                       version_       = 0u;
-        int32_t                        priority_      = 0u;
-        supported_memory_type          memory_type_   = supported_memory_type::non_durable;
-        uint64_t                       portal_mask_   = 0u; /**< Mask for incrementing portals */
-        mutable void                  *portal_ptr_    = nullptr;
-        mutable std::atomic<uintptr_t> portal_offset_ = 0u; /**< Portal for enqcmd (mod page size)*/
+        /**
+         * @brief State of a dedicated work queue
+         *
+         * MOVDIR64B doesn't report whether the queue took the descriptor, a descriptor written to a full
+         * queue is lost. So the queue has a single producer thread, and it submits only while it has credits.
+         * Credits are taken on submission and returned once the completion of the descriptor is observed.
+         * Completion records of submitted descriptors are kept in a table shared by all queues, so a record
+         * finds its credit without looking through the queues.
+         */
+        struct producer_state
+        {
+            explicit producer_state(uint32_t size) noexcept;
+
+            std::atomic<uintptr_t> owner   = 0u; /**< Thread that submits to the queue, 0 if none */
+            std::atomic<uint32_t>  credits = 0u; /**< Descriptors the queue can take */
+            uint32_t               size    = 0u; /**< Descriptors the queue holds */
+        };
+
+        [[nodiscard]] auto enqueue_dedicated(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
+
+        /**
+         * @brief Counters updated by every submission, on their own cache line as all submitters write them
+         */
+        struct alignas(64) counters
+        {
+            std::atomic<uint64_t> submissions = 0u; /**< Accepted descriptors */
+            std::atomic<uint64_t> retries     = 0u; /**< Rejected descriptors */
+            std::atomic<uint64_t> last_retry  = 0u; /**< TSC of the last rejection */
+        };
+
+        uint32_t                       version_             = 0u;
+        int32_t                        priority_            = 0u;
+        supported_memory_type          memory_type_         = supported_memory_type::non_durable;
+        uint64_t                       portal_mask_         = 0u; /**< Mask for incrementing portals */
+        mutable void                  *portal_ptr_          = nullptr;
+        mutable std::atomic<uintptr_t> portal_offset_       = 0u; /**< Portal for enqcmd (mod page size)*/
+        hw_emulator                   *emulator_            = nullptr; /**< Takes descriptors instead of the portal if set */
+        uint32_t                       emulated_device_idx_ = 0u;      /**< Device of the emulated queue */
+        uint32_t                       emulated_queue_idx_  = 0u;      /**< Index of the emulated queue in its device */
+        mutable counters               counters_            = {};
+        std::unique_ptr<producer_state> dedicated_;                         /**< Set for dedicated work queues */
     };
 
 }  // namespace dml::core::dispatcher
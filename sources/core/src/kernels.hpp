@@ -44,6 +44,16 @@ namespace dml::core::kernels
     void dif_update(const_view<descriptor, operation::dif_update> dsc) noexcept;
 
     void cache_flush(const_view<descriptor, operation::cache_flush> dsc) noexcept;
+
+    /**
+     * @brief Executes the operation in parts on the thread pool, returns false if the operation can't be split
+     */
+    bool execute_parallel(const descriptor &dsc) noexcept;
+
+    /**
+     * @brief Calculates CRC in parts on the thread pool, returns false if the buffer is too small to split
+     */
+    bool crc_parallel(const_view<descriptor, operation::crc> dsc) noexcept;
 }  // namespace dml::core::kernels
 
 #endif  //DML_CORE_OWN_KERNELS_HPP
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/descriptor_views.hpp>
+#include <core/operations.hpp>
+#include <core/split.hpp>
+#include <core/thread_pool.hpp>
+#include <core/utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "immintrin.h"
+#include "kernels.hpp"
+
+namespace dml::core::kernels
+{
+    /**
+     * @brief The smallest part of the transfer executed by one thread
+     */
+    constexpr transfer_size_t parallel_min_part_size = 256u << 10u;
+
+    /**
+     * @brief Part boundaries are multiples of the cache line, which also keeps 8-byte patterns in phase
+     */
+    constexpr transfer_size_t parallel_part_alignment = 64u;
+
+    /**
+     * @brief Parts of an operation, shared by all threads executing it
+     */
+    struct parallel_parts
+    {
+        descriptor                     dsc;
+        transfer_size_t                part_size;
+        std::vector<completion_record> records;
+        std::atomic<size_t>            next{ 0u };
+        std::atomic<size_t>            done{ 0u };
+    };
+
+    static void execute_part(parallel_parts &parts, size_t index) noexcept
+    {
+        const auto offset        = static_cast<transfer_size_t>(index) * parts.part_size;
+        const auto transfer_size = any_descriptor(parts.dsc).transfer_size();
+
+        auto part = make_part(parts.dsc, offset, std::min(parts.part_size, transfer_size - offset));
+
+        any_descriptor(part).completion_record_address() = reinterpret_cast<address_t>(&parts.records[index]);
+
+        switch (operation(any_descriptor(part).operation()))
+        {
+            case operation::mem_move:
+                kernels::mem_move(make_view<operation::mem_move>(std::as_const(part)));
+                break;
+            case operation::fill:
+                kernels::fill(make_view<operation::fill>(std::as_const(part)));
+                break;
+            case operation::compare:
+                kernels::compare(make_view<operation::compare>(std::as_const(part)));
+                break;
+            case operation::compare_pattern:
+                kernels::compare_pattern(make_view<operation::compare_pattern>(std::as_const(part)));
+                break;
+            case operation::dualcast:
+                kernels::dualcast(make_view<operation::dualcast>(std::as_const(part)));
+                break;
+            case operation::cache_flush:
+                kernels::cache_flush(make_view<operation::cache_flush>(std::as_const(part)));
+                break;
+            default:
+                break;
+        }
+    }
+
+    static void process(parallel_parts &parts) noexcept
+    {
+        const auto count = parts.records.size();
+
+        for (auto index = parts.next.fetch_add(1u); index < count; index = parts.next.fetch_add(1u))
+        {
+            execute_part(parts, index);
+
+            parts.done.fetch_add(1u, std::memory_order_acq_rel);
+        }
+    }
+
+    bool execute_parallel(const descriptor &dsc) noexcept
+    {
+        // Parts of CRC are combined rather than merged, so it has its own splitting
+        if (operation(any_descriptor(dsc).operation()) == operation::crc)
+        {
+            return crc_parallel(make_view<operation::crc>(dsc));
+        }
+
+        // Dualcast writes nothing but the status, so its parts merge as well
+        if (operation(any_descriptor(dsc).operation()) != operation::dualcast && !is_splittable(dsc))
+        {
+            return false;
+        }
+
+        auto &pool = thread_pool::get_instance();
+
+        const auto transfer_size = any_descriptor(dsc).transfer_size();
+        const auto count         = std::min<size_t>(pool.size(), transfer_size / parallel_min_part_size);
+
+        if (count < 2u)
+        {
+            return false;
+        }
+
+        // Helpers may start after the operation is done, so the state is shared with them
+        auto parts       = std::make_shared<parallel_parts>();
+        parts->dsc       = dsc;
+        parts->part_size = static_cast<transfer_size_t>(
+            ((transfer_size / count + parallel_part_alignment - 1u) / parallel_part_alignment) * parallel_part_alignment);
+        parts->records.resize((transfer_size + parts->part_size - 1u) / parts->part_size);
+
+        for (auto i = size_t(1); i < parts->records.size(); ++i)
+        {
+            pool.submit(
+                [parts]
+                {
+                    process(*parts);
+                });
+        }
+
+        // The calling thread takes parts too, so the operation never waits for a free worker
+        process(*parts);
+
+        while (parts->done.load(std::memory_order_acquire) != parts->records.size())
+        {
+            _mm_pause();
+        }
+
+        auto merged = std::vector<split_part>(parts->records.size());
+
+        for (auto index = size_t(0); index < merged.size(); ++index)
+        {
+            const auto offset = static_cast<transfer_size_t>(index) * parts->part_size;
+
+            merged[index] = { &parts->records[index], offset, std::min(parts->part_size, transfer_size - offset) };
+        }
+
+        merge_parts(dsc, merged.data(), merged.size());
+
+        return true;
+    }
+}  // namespace dml::core::kernels
@@ -9,16 +9,27 @@
 #include <core/operations.hpp>
 #include <dml/detail/common/status.hpp>
 
+#include <atomic>
+
 #include "core/device.hpp"
 #include "kernels.hpp"
 
 namespace dml::core
 {
+    static std::atomic<std::uint32_t> gs_parallel_threshold{ 0u };
+
     dml::detail::submission_status software_device::submit(const descriptor& dsc) noexcept
     {
         auto  view   = any_descriptor(dsc);
         auto  op     = operation(view.operation());
 
+        const auto threshold = gs_parallel_threshold.load(std::memory_order_relaxed);
+
+        if (threshold != 0u && view.transfer_size() >= threshold && kernels::execute_parallel(dsc))
+        {
+            return dml::detail::submission_status::success;
+        }
+
         switch (op)
         {
             case operation::nop:
@@ -78,4 +89,9 @@ namespace dml::core
 
         return dml::detail::submission_status::success;
     }
+
+    void software_device::set_parallel_threshold(std::uint32_t threshold) noexcept
+    {
+        gs_parallel_threshold.store(threshold, std::memory_order_relaxed);
+    }
 }  // namespace dml::core
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/completion_record_views.hpp>
+#include <core/descriptor_views.hpp>
+#include <core/operations.hpp>
+#include <core/split.hpp>
+#include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
+#include <dml/detail/common/specific_flags.hpp>
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/bits.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
+
+#include <algorithm>
+
+#include "immintrin.h"
+
+namespace dml::core
+{
+    /**
+     * @brief Offset of the state in the completion record, none of the operations that can be split writes there
+     */
+    constexpr auto split_state_offset = 24u;
+
+    static bool is_split_operation(const descriptor &dsc) noexcept
+    {
+        switch (static_cast<operation>(any_descriptor(dsc).operation()))
+        {
+            case operation::mem_move:
+            case operation::fill:
+            case operation::compare:
+            case operation::compare_pattern:
+            case operation::crc:
+            case operation::cache_flush:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static auto &get_split_state(const descriptor &dsc) noexcept
+    {
+        return reinterpret_cast<split_operation *&>(get_completion_record(dsc).bytes[split_state_offset]);
+    }
+
+    void attach(const descriptor &dsc, std::unique_ptr<split_operation> state) noexcept
+    {
+        get_split_state(dsc) = state.release();
+    }
+
+    /**
+     * @brief Completes the split descriptor once the waiter returns true, does nothing for other descriptors
+     */
+    template <typename waiter_t>
+    static bool gather(const descriptor &dsc, waiter_t &&waiter) noexcept
+    {
+        // Records of other operations may have these bytes written, a complete record has no state
+        if (!is_split_operation(dsc) || get_completion_record(dsc).bytes[0] != 0u)
+        {
+            return true;
+        }
+
+        auto &state_ptr = get_split_state(dsc);
+
+        if (state_ptr == nullptr)
+        {
+            return true;
+        }
+
+        if (!waiter(*state_ptr))
+        {
+            return false;
+        }
+
+        auto state = std::unique_ptr<split_operation>(state_ptr);
+        state_ptr  = nullptr;
+
+        state->merge(dsc);
+
+        return true;
+    }
+
+    bool gather(const descriptor &dsc, bool blocking) noexcept
+    {
+        return gather(dsc,
+                      [blocking](split_operation &state)
+                      {
+                          return state.wait(blocking);
+                      });
+    }
+
+    void gather(const descriptor &dsc, const dml::detail::wait_parameters &parameters, dml::detail::wait_counters *counters) noexcept
+    {
+        static_cast<void>(gather(dsc,
+                                 [&parameters, counters](split_operation &state)
+                                 {
+                                     state.wait(parameters, counters);
+
+                                     return true;
+                                 }));
+    }
+
+    bool is_splittable(const descriptor &dsc) noexcept
+    {
+        auto view = any_descriptor(dsc);
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::mem_move:
+            {
+                const auto src  = view.source_address();
+                const auto dst  = view.destination_address();
+                const auto size = view.transfer_size();
+
+                // Parts of overlapping buffers depend on each other
+                return (src + size) <= dst || (dst + size) <= src;
+            }
+            case operation::fill:
+            case operation::cache_flush:
+                return true;
+            case operation::compare:
+            case operation::compare_pattern:
+                // Expected result is checked for the whole transfer, not for each part
+                return !dml::detail::intersects(view.flags(), dml::detail::compare_flag::check_result);
+            case operation::crc:
+                // Seed in memory is read by the first part only
+                return !dml::detail::intersects(view.operation_specific_flags(), dml::detail::crc_specific_flag::read_crc_seed);
+            default:
+                return false;
+        }
+    }
+
+    descriptor make_part(const descriptor &dsc, transfer_size_t offset, transfer_size_t size) noexcept
+    {
+        auto part = dsc;
+        auto view = any_descriptor(part);
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::mem_move:
+            case operation::compare:
+                view.source_address() += offset;
+                view.destination_address() += offset;
+                break;
+            case operation::fill:
+            case operation::cache_flush:
+                view.destination_address() += offset;
+                break;
+            case operation::dualcast:
+                view.source_address() += offset;
+                make_view<operation::dualcast>(part).destination_1_address() += offset;
+                make_view<operation::dualcast>(part).destination_2_address() += offset;
+                break;
+            case operation::crc:
+                view.source_address() += offset;
+
+                if (offset != 0u)
+                {
+                    make_view<operation::crc>(part).crc_seed() = convert_crc(dsc, 0u);
+                }
+                break;
+            default:
+                view.source_address() += offset;
+                break;
+        }
+
+        view.transfer_size() = size;
+
+        return part;
+    }
+
+    uint32_t convert_crc(const descriptor &dsc, uint32_t crc_value) noexcept
+    {
+        auto view = any_descriptor(dsc);
+
+        if (dml::detail::intersects(view.operation_specific_flags(),
+                                    dml::detail::crc_specific_flag::bypass_crc_inversion_and_reflection))
+        {
+            return crc_value;
+        }
+
+        return dml::detail::reverse_bits(~crc_value);
+    }
+
+    void merge_parts(const descriptor &dsc, const split_part *parts, size_t count) noexcept
+    {
+        constexpr auto remove_rw_bit_mask = 0x7f;  // READ/WRITE page fault bit is 0x80
+
+        const auto end      = parts + count;
+        const auto selected = std::find_if(parts,
+                                           end,
+                                           [](const split_part &part)
+                                           {
+                                               auto part_record = any_completion_record(*part.record);
+
+                                               return part_record.result() != 0u ||
+                                                      (part_record.status() & remove_rw_bit_mask) !=
+                                                          dml::detail::to_underlying(dml::detail::execution_status::success);
+                                           });
+
+        const auto is_failed = selected != end;
+        const auto &result   = is_failed ? *selected : parts[0];
+
+        auto &whole_record = get_completion_record(dsc);
+        auto  record       = any_completion_record(whole_record);
+        auto  part_record  = any_completion_record(*result.record);
+
+        record.result()          = part_record.result();
+        record.bytes_completed() = part_record.bytes_completed() + (is_failed ? result.offset : 0u);
+        record.fault_address()   = part_record.fault_address();
+
+        if (any_descriptor(dsc).operation() == dml::detail::to_underlying(operation::crc))
+        {
+            const auto last      = is_failed ? selected : end - 1;
+            auto       crc_value = convert_crc(dsc, make_view<operation::crc>(*parts[0].record).crc_value());
+
+            for (auto part = parts + 1; part <= last; ++part)
+            {
+                const auto size = (part == selected) ? any_completion_record(*part->record).bytes_completed() : part->size;
+
+                crc_value = dispatch::crc_combine(crc_value, convert_crc(dsc, make_view<operation::crc>(*part->record).crc_value()), size);
+            }
+
+            make_view<operation::crc>(whole_record).crc_value() = convert_crc(dsc, crc_value);
+        }
+
+        _mm_mfence();
+        record.status() = part_record.status();
+    }
+}  // namespace dml::core
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/**
+ * @brief Returns mask of equal bytes in two 32-byte vectors
+ */
+static inline uint32_t own_equal_mask(const uint8_t *src1, const uint8_t *src2)
+{
+    const __m256i y1 = _mm256_loadu_si256((const __m256i *)src1);
+    const __m256i y2 = _mm256_loadu_si256((const __m256i *)src2);
+
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(y1, y2));
+}
+
+uint32_t dml_avx2_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result)
+{
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+
+    const uint32_t all_equal   = 0xFFFFFFFFu;
+    const uint32_t vector_size = sizeof(__m256i);
+
+    uint32_t i = 0u;
+
+    for (; (i + 4u * vector_size) <= transfer_size; i += 4u * vector_size)
+    {
+        const __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src1 + i + 0u * vector_size)),
+                                            _mm256_loadu_si256((const __m256i *)(src2 + i + 0u * vector_size)));
+        const __m256i x1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src1 + i + 1u * vector_size)),
+                                            _mm256_loadu_si256((const __m256i *)(src2 + i + 1u * vector_size)));
+        const __m256i x2 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src1 + i + 2u * vector_size)),
+                                            _mm256_loadu_si256((const __m256i *)(src2 + i + 2u * vector_size)));
+        const __m256i x3 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src1 + i + 3u * vector_size)),
+                                            _mm256_loadu_si256((const __m256i *)(src2 + i + 3u * vector_size)));
+
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+
+        if (!_mm256_testz_si256(any, any))
+        {
+            // Mismatch is somewhere in these 128 bytes, find it below
+            break;
+        }
+    }
+
+    for (; (i + vector_size) <= transfer_size; i += vector_size)
+    {
+        const uint32_t mask = own_equal_mask(src1 + i, src2 + i);
+
+        if (all_equal != mask)
+        {
+            *result = not_equal;
+            return i + (uint32_t)_tzcnt_u32(~mask);
+        }
+    }
+
+    if (i < transfer_size)
+    {
+        if (transfer_size >= vector_size)
+        {
+            // The last vector overlaps already compared bytes, which are equal
+            const uint32_t last = transfer_size - vector_size;
+            const uint32_t mask = own_equal_mask(src1 + last, src2 + last);
+
+            if (all_equal != mask)
+            {
+                *result = not_equal;
+                return last + (uint32_t)_tzcnt_u32(~mask);
+            }
+        }
+        else
+        {
+            for (; i < transfer_size; ++i)
+            {
+                if (src1[i] != src2[i])
+                {
+                    *result = not_equal;
+                    return i;
+                }
+            }
+        }
+    }
+
+    *result = equal;
+    return 0;
+}
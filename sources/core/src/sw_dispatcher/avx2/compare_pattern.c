@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/**
+ * @brief Returns mask of four 8-byte chunks not equal to the pattern
+ */
+static inline uint32_t own_not_equal_mask(const uint8_t *src, __m256i pattern)
+{
+    const __m256i chunks = _mm256_loadu_si256((const __m256i *)src);
+
+    return (~(uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(chunks, pattern)))) & 0xFu;
+}
+
+uint32_t dml_avx2_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result)
+{
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+
+    const uint32_t chunk_size  = sizeof(pattern);
+    const uint32_t vector_size = sizeof(__m256i);
+    const uint32_t head_size   = transfer_size - transfer_size % chunk_size;
+
+    const __m256i y_pattern = _mm256_set1_epi64x((long long)pattern);
+
+    uint32_t i = 0u;
+
+    for (; (i + 4u * vector_size) <= head_size; i += 4u * vector_size)
+    {
+        const __m256i y0 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(src + i + 0u * vector_size)), y_pattern);
+        const __m256i y1 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(src + i + 1u * vector_size)), y_pattern);
+        const __m256i y2 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(src + i + 2u * vector_size)), y_pattern);
+        const __m256i y3 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(src + i + 3u * vector_size)), y_pattern);
+
+        const __m256i all = _mm256_and_si256(_mm256_and_si256(y0, y1), _mm256_and_si256(y2, y3));
+
+        if (0xFFFFFFFFu != (uint32_t)_mm256_movemask_epi8(all))
+        {
+            // Mismatch is somewhere in these 128 bytes, find it below
+            break;
+        }
+    }
+
+    for (; (i + vector_size) <= head_size; i += vector_size)
+    {
+        const uint32_t mask = own_not_equal_mask(src + i, y_pattern);
+
+        if (mask)
+        {
+            *result = not_equal;
+            return i + (uint32_t)_tzcnt_u32(mask) * chunk_size;
+        }
+    }
+
+    for (; i < head_size; i += chunk_size)
+    {
+        if (*(const uint64_t *)(src + i) != pattern)
+        {
+            *result = not_equal;
+            return i;
+        }
+    }
+
+    const uint8_t *const pattern_u8 = (const uint8_t *)&pattern;
+
+    for (; i < transfer_size; ++i)
+    {
+        // No overflow for pattern, tail is shorter than the pattern
+        if (src[i] != pattern_u8[i - head_size])
+        {
+            *result = not_equal;
+            return i;
+        }
+    }
+
+    *result = equal;
+    return 0;
+}
@@ -0,0 +1,419 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ * CRC32 with carry-less multiplication folding.
+ *
+ * Data is treated as polynomial over GF(2) with the first bit at the highest degree,
+ * which is the non-reflected (MSB-first) CRC. 128-bit blocks are folded forward with
+ * X * x^T = X_hi * (x^(T+64) mod P) + X_lo * (x^T mod P), the last block is reduced
+ * to 64 bits and then to 32 bits with Barrett reduction.
+ *
+ * Reflected CRC is folded in bit-reversed registers, which allows to load data as is.
+ * Since bit-reversed multiplication is shifted by one bit, reflected constants are
+ * bit-reversed (x^(T-1) mod P) placed into the high half of 64-bit lane.
+ * The final 128-bit value is bit-reversed back and reduced the same way.
+ *
+ * Copy with CRC stores every loaded block to the destination, so the source is read once.
+ *
+ * Constants for polynomials other than the predefined ones are generated on the first use
+ * and cached per thread for a few polynomials, so the same folding is used for any 32-bit polynomial.
+ */
+
+#include <string.h>
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+#if defined(_MSC_BUILD)
+#define OWN_THREAD_LOCAL __declspec(thread)
+#else
+#define OWN_THREAD_LOCAL _Thread_local
+#endif
+
+#define OWN_DEFAULT_POLYNOMIAL 0x1EDC6F41u
+#define OWN_T10DIF_POLYNOMIAL  0x8BB70000u /**< CRC16 T10 DIF polynomial multiplied by x^16 */
+#define OWN_CACHED_POLYNOMIALS 4u          /**< Polynomials with generated constants kept per thread */
+
+typedef struct
+{
+    uint64_t fold_512[2];           /**< x^512 mod P, x^576 mod P */
+    uint64_t fold_128[2];           /**< x^128 mod P, x^192 mod P */
+    uint64_t fold_512_reflected[2]; /**< Reflected x^575 mod P, x^511 mod P */
+    uint64_t fold_128_reflected[2]; /**< Reflected x^191 mod P, x^127 mod P */
+    uint64_t reduce[2];             /**< x^96 mod P, x^64 mod P */
+    uint64_t barrett[2];            /**< floor(x^64 / P), P */
+} own_crc_constants;
+
+static const own_crc_constants own_default_constants = {
+    { 0xAA97D41Du, 0xA6955F31u },
+    { 0x18571D18u, 0x6503EA99u },
+    { 0x1C19243B00000000u, 0x75BBA45B00000000u },
+    { 0x3743F7BD00000000u, 0x3171D43000000000u },
+    { 0xD7A01665u, 0x3AAB4576u },
+    { 0x11F91CAF6u, 0x100000000u | OWN_DEFAULT_POLYNOMIAL },
+};
+
+/*
+ * CRC16 T10 DIF is calculated as CRC32 with the polynomial P * x^16, CRC value is in the high 16 bits
+ * of the state. T10 DIF is not reflected, so reflected constants are not used.
+ */
+static const own_crc_constants own_t10dif_constants = {
+    { 0x87E70000u, 0x371D0000u },
+    { 0xFB0B0000u, 0x4C1A0000u },
+    { 0u, 0u },
+    { 0u, 0u },
+    { 0x2D560000u, 0x13680000u },
+    { 0x1F65A57F8u, 0x100000000u | OWN_T10DIF_POLYNOMIAL },
+};
+
+static inline __m128i own_load_constants(const uint64_t constants[2])
+{
+    return _mm_loadu_si128((const __m128i *)constants);
+}
+
+static inline __m128i own_byte_swap(__m128i value)
+{
+    return _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+static inline __m128i own_load_be(const uint8_t *src)
+{
+    return own_byte_swap(_mm_loadu_si128((const __m128i *)src));
+}
+
+static inline __m128i own_fold(__m128i value, __m128i constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00), _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+static inline uint8_t own_reverse_byte(uint8_t byte)
+{
+    byte = (uint8_t)(((byte & 0x55u) << 1u) | ((byte & 0xAAu) >> 1u));
+    byte = (uint8_t)(((byte & 0x33u) << 2u) | ((byte & 0xCCu) >> 2u));
+    byte = (uint8_t)(((byte & 0x0Fu) << 4u) | ((byte & 0xF0u) >> 4u));
+
+    return byte;
+}
+
+static inline uint32_t own_reverse_32u(uint32_t value)
+{
+    value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
+    value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
+    value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
+    value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
+    value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
+
+    return value;
+}
+
+/**
+ * @brief Returns bit-reflected x^power mod P placed into the high half of 64-bit lane
+ */
+static inline uint64_t own_reflected_constant(uint32_t remainder)
+{
+    return (uint64_t)own_reverse_32u(remainder) << 32u;
+}
+
+/**
+ * @brief Calculates folding and reduction constants for the given polynomial
+ */
+static void own_generate_constants(uint32_t polynomial, own_crc_constants *constants)
+{
+    // x^power mod P for powers 32..576 in one pass
+    uint32_t remainder = polynomial;
+
+    for (uint32_t power = 33u; power <= 576u; ++power)
+    {
+        remainder = (remainder << 1u) ^ ((remainder & 0x80000000u) ? polynomial : 0u);
+
+        switch (power)
+        {
+            case 64u: constants->reduce[1] = remainder; break;
+            case 96u: constants->reduce[0] = remainder; break;
+            case 127u: constants->fold_128_reflected[1] = own_reflected_constant(remainder); break;
+            case 128u: constants->fold_128[0] = remainder; break;
+            case 191u: constants->fold_128_reflected[0] = own_reflected_constant(remainder); break;
+            case 192u: constants->fold_128[1] = remainder; break;
+            case 511u: constants->fold_512_reflected[1] = own_reflected_constant(remainder); break;
+            case 512u: constants->fold_512[0] = remainder; break;
+            case 575u: constants->fold_512_reflected[0] = own_reflected_constant(remainder); break;
+            case 576u: constants->fold_512[1] = remainder; break;
+            default: break;
+        }
+    }
+
+    // floor(x^64 / P) with long division, the quotient has 33 bits
+    const uint64_t divisor  = 0x100000000u | polynomial;
+    uint64_t       dividend = 0u;
+    uint64_t       quotient = 0u;
+
+    for (int32_t bit = 64; bit >= 0; --bit)
+    {
+        dividend = (dividend << 1u) | ((64 == bit) ? 1u : 0u);
+        quotient <<= 1u;
+
+        if (dividend & 0x100000000u)
+        {
+            dividend ^= divisor;
+            quotient |= 1u;
+        }
+    }
+
+    constants->barrett[0] = quotient;
+    constants->barrett[1] = divisor;
+}
+
+/**
+ * @brief Returns constants for the given polynomial, generated ones are cached for the last few used polynomials
+ */
+static inline const own_crc_constants *own_get_constants(uint32_t polynomial)
+{
+    static OWN_THREAD_LOCAL own_crc_constants cached_constants[OWN_CACHED_POLYNOMIALS];
+    static OWN_THREAD_LOCAL uint32_t          cached_polynomials[OWN_CACHED_POLYNOMIALS];
+    static OWN_THREAD_LOCAL uint32_t          cached_count;
+    static OWN_THREAD_LOCAL uint32_t          next_entry;
+
+    if (OWN_DEFAULT_POLYNOMIAL == polynomial)
+    {
+        return &own_default_constants;
+    }
+
+    for (uint32_t entry = 0u; entry < cached_count; ++entry)
+    {
+        if (cached_polynomials[entry] == polynomial)
+        {
+            return &cached_constants[entry];
+        }
+    }
+
+    // Entries are replaced in the order they were filled
+    const uint32_t entry = next_entry;
+
+    own_generate_constants(polynomial, &cached_constants[entry]);
+    cached_polynomials[entry] = polynomial;
+
+    next_entry   = (entry + 1u) % OWN_CACHED_POLYNOMIALS;
+    cached_count = (cached_count < OWN_CACHED_POLYNOMIALS) ? cached_count + 1u : cached_count;
+
+    return &cached_constants[entry];
+}
+
+/**
+ * @brief Reverses all 128 bits of the register
+ */
+static inline __m128i own_reverse_128(__m128i value)
+{
+    const __m128i low_nibble   = _mm_set1_epi8(0x0F);
+    const __m128i reversed_low = _mm_set_epi8(15, 7, 11, 3, 13, 5, 9, 1, 14, 6, 10, 2, 12, 4, 8, 0);
+    const __m128i reversed_high =
+        _mm_set_epi8(-16, 112, -80, 48, -48, 80, -112, 16, -32, 96, -96, 32, -64, 64, -128, 0);
+    const __m128i byte_swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    const __m128i low  = _mm_and_si128(value, low_nibble);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), low_nibble);
+
+    value = _mm_or_si128(_mm_shuffle_epi8(reversed_high, low), _mm_shuffle_epi8(reversed_low, high));
+
+    return _mm_shuffle_epi8(value, byte_swap);
+}
+
+/**
+ * @brief Returns (value * x^32) mod P
+ */
+static inline uint32_t own_reduce_128(__m128i value, const own_crc_constants *constants)
+{
+    const __m128i reduce  = own_load_constants(constants->reduce);
+    const __m128i barrett = own_load_constants(constants->barrett);
+
+    // 128 -> 96 bits: high * (x^96 mod P) + low * x^32
+    value = _mm_xor_si128(_mm_clmulepi64_si128(value, reduce, 0x01), _mm_slli_si128(_mm_move_epi64(value), 4));
+
+    // 96 -> 64 bits: high * (x^64 mod P) + low
+    value = _mm_xor_si128(_mm_clmulepi64_si128(value, reduce, 0x11), _mm_move_epi64(value));
+
+    // Barrett reduction
+    __m128i quotient = _mm_clmulepi64_si128(_mm_srli_epi64(value, 32), barrett, 0x00);
+    quotient         = _mm_srli_epi64(quotient, 32);
+
+    value = _mm_xor_si128(value, _mm_clmulepi64_si128(quotient, barrett, 0x10));
+
+    return (uint32_t)_mm_cvtsi128_si32(value);
+}
+
+/**
+ * @brief Appends less than 16 bytes to the CRC
+ */
+static inline uint32_t own_crc_tail(const uint8_t           *src,
+                                    uint32_t                 transfer_size,
+                                    uint32_t                 crc_value,
+                                    int                      reflected,
+                                    const own_crc_constants *constants)
+{
+    uint8_t buffer[16] = { 0 };
+
+    uint8_t *const tail = buffer + sizeof(buffer) - transfer_size;
+
+    memcpy(tail, src, transfer_size);
+
+    for (uint32_t i = 0u; i < transfer_size; ++i)
+    {
+        tail[i] = reflected ? own_reverse_byte(tail[i]) : tail[i];
+    }
+
+    // Message is (crc * x^(8 * size) + tail), so CRC overlaps the first tail bytes
+    for (uint32_t i = 0u; i < transfer_size && i < sizeof(crc_value); ++i)
+    {
+        tail[i] ^= (uint8_t)(crc_value >> (24u - 8u * i));
+    }
+
+    uint32_t result = own_reduce_128(own_load_be(buffer), constants);
+
+    // Low CRC bits which were not covered by tail are already reduced
+    if (transfer_size < sizeof(crc_value))
+    {
+        result ^= crc_value << (8u * transfer_size);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Loads 16 bytes of the message, stores them to the destination if it is given
+ */
+static inline __m128i own_load_block(const uint8_t *src, uint8_t *dst, uint32_t offset, int reflected)
+{
+    const __m128i block = _mm_loadu_si128((const __m128i *)(src + offset));
+
+    if (dst)
+    {
+        _mm_storeu_si128((__m128i *)(dst + offset), block);
+    }
+
+    return reflected ? block : own_byte_swap(block);
+}
+
+/**
+ * @brief Folds the message and copies it to dst in the same pass if dst is not NULL
+ */
+static inline uint32_t own_crc_fold(const uint8_t           *src,
+                                    uint8_t                 *dst,
+                                    uint32_t                 transfer_size,
+                                    uint32_t                 crc_value,
+                                    int                      reflected,
+                                    const own_crc_constants *constants)
+{
+    uint32_t offset = 0u;
+
+    if (transfer_size >= 16u)
+    {
+        const __m128i fold_128 = own_load_constants(reflected ? constants->fold_128_reflected : constants->fold_128);
+
+        __m128i value = own_load_block(src, dst, 0u, reflected);
+
+        value = _mm_xor_si128(value, reflected ? _mm_cvtsi32_si128((int)own_reverse_32u(crc_value))
+                                               : _mm_set_epi32((int)crc_value, 0, 0, 0));
+
+        offset = 16u;
+
+        if ((transfer_size - offset) >= 48u)
+        {
+            const __m128i fold_512 = own_load_constants(reflected ? constants->fold_512_reflected : constants->fold_512);
+
+            __m128i value1 = own_load_block(src, dst, offset + 0u, reflected);
+            __m128i value2 = own_load_block(src, dst, offset + 16u, reflected);
+            __m128i value3 = own_load_block(src, dst, offset + 32u, reflected);
+
+            offset += 48u;
+
+            // One cache line per iteration
+            while ((transfer_size - offset) >= 64u)
+            {
+                value  = _mm_xor_si128(own_fold(value, fold_512), own_load_block(src, dst, offset + 0u, reflected));
+                value1 = _mm_xor_si128(own_fold(value1, fold_512), own_load_block(src, dst, offset + 16u, reflected));
+                value2 = _mm_xor_si128(own_fold(value2, fold_512), own_load_block(src, dst, offset + 32u, reflected));
+                value3 = _mm_xor_si128(own_fold(value3, fold_512), own_load_block(src, dst, offset + 48u, reflected));
+
+                offset += 64u;
+            }
+
+            value = _mm_xor_si128(own_fold(value, fold_128), value1);
+            value = _mm_xor_si128(own_fold(value, fold_128), value2);
+            value = _mm_xor_si128(own_fold(value, fold_128), value3);
+        }
+
+        while ((transfer_size - offset) >= 16u)
+        {
+            value = _mm_xor_si128(own_fold(value, fold_128), own_load_block(src, dst, offset, reflected));
+
+            offset += 16u;
+        }
+
+        crc_value = own_reduce_128(reflected ? own_reverse_128(value) : value, constants);
+    }
+
+    if (offset == transfer_size)
+    {
+        return crc_value;
+    }
+
+    if (dst)
+    {
+        memcpy(dst + offset, src + offset, transfer_size - offset);
+    }
+
+    return own_crc_tail(src + offset, transfer_size - offset, crc_value, reflected, constants);
+}
+
+/**
+ * @brief Returns non-zero if the buffers overlap, so copy cannot be fused with CRC calculation
+ */
+static inline int own_overlaps(const uint8_t *src, const uint8_t *dst, uint32_t transfer_size)
+{
+    return (src < dst + transfer_size) && (dst < src + transfer_size);
+}
+
+uint32_t dml_avx2_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_crc_fold(src, NULL, transfer_size, crc_value, 0, own_get_constants(polynomial));
+}
+
+uint32_t dml_avx2_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_crc_fold(src, NULL, transfer_size, crc_value, 1, own_get_constants(polynomial));
+}
+
+uint32_t dml_avx2_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    if (own_overlaps(src, dst, transfer_size))
+    {
+        return dml_ref_copy_crc_u32(src, dst, transfer_size, crc_value, polynomial);
+    }
+
+    return own_crc_fold(src, dst, transfer_size, crc_value, 0, own_get_constants(polynomial));
+}
+
+uint32_t dml_avx2_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    if (own_overlaps(src, dst, transfer_size))
+    {
+        return dml_ref_copy_crc_reflected_u32(src, dst, transfer_size, crc_value, polynomial);
+    }
+
+    return own_crc_fold(src, dst, transfer_size, crc_value, 1, own_get_constants(polynomial));
+}
+
+uint16_t dml_avx2_crc16_t10dif(const uint8_t *src, uint32_t transfer_size, uint16_t crc_value)
+{
+    return (uint16_t)(own_crc_fold(src, NULL, transfer_size, (uint32_t)crc_value << 16u, 0, &own_t10dif_constants) >> 16u);
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+typedef uint64_t block_t;
+typedef uint16_t offset_t;
+
+#define OWN_DELTA_NOTE_SIZE (sizeof(offset_t) + sizeof(block_t))
+
+/**
+ * @brief Returns mask of four 8-byte blocks which differ
+ */
+static inline uint32_t own_mismatch_mask(const uint8_t *src1, const uint8_t *src2)
+{
+    const __m256i y1 = _mm256_loadu_si256((const __m256i *)src1);
+    const __m256i y2 = _mm256_loadu_si256((const __m256i *)src2);
+
+    return (~(uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(y1, y2)))) & 0xFu;
+}
+
+/**
+ * @brief Writes delta notes for each set bit of the mask, returns false if the delta record overflows
+ */
+static inline int own_write_notes(const uint8_t *src2,
+                                  uint32_t       first_block,
+                                  uint32_t       mask,
+                                  uint8_t       *delta_record,
+                                  uint32_t       delta_record_max_size,
+                                  uint32_t      *delta_record_size)
+{
+    while (mask)
+    {
+        if ((*delta_record_size + OWN_DELTA_NOTE_SIZE) > delta_record_max_size)
+        {
+            return 0;
+        }
+
+        const uint32_t index  = first_block + (uint32_t)_tzcnt_u32(mask);
+        const offset_t offset = (offset_t)index;
+
+        uint8_t *const delta_position = delta_record + *delta_record_size;
+
+        memcpy(delta_position, &offset, sizeof(offset_t));
+        memcpy(delta_position + sizeof(offset_t), src2 + index * sizeof(block_t), sizeof(block_t));
+
+        *delta_record_size += (uint32_t)OWN_DELTA_NOTE_SIZE;
+
+        mask = _blsr_u32(mask);
+    }
+
+    return 1;
+}
+
+uint32_t dml_avx2_create_delta(const uint8_t *src1,
+                               const uint8_t *src2,
+                               uint32_t       transfer_size,
+                               uint8_t       *delta_record,
+                               uint32_t       delta_record_max_size,
+                               uint8_t       *result)
+{
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+    const uint8_t overflow  = 0x2;
+
+    const uint32_t blocks_per_vector = sizeof(__m256i) / sizeof(block_t);
+    const uint32_t block_count       = transfer_size / (uint32_t)sizeof(block_t);
+
+    uint32_t delta_record_size = 0u;
+    uint32_t index             = 0u;
+
+    for (; (index + 4u * blocks_per_vector) <= block_count; index += 4u * blocks_per_vector)
+    {
+        const uint8_t *const block1 = src1 + index * sizeof(block_t);
+        const uint8_t *const block2 = src2 + index * sizeof(block_t);
+
+        // 16 blocks at once, most of them are expected to be equal
+        const uint32_t mask = own_mismatch_mask(block1 + 0u * sizeof(__m256i), block2 + 0u * sizeof(__m256i)) |
+                              own_mismatch_mask(block1 + 1u * sizeof(__m256i), block2 + 1u * sizeof(__m256i)) << 4u |
+                              own_mismatch_mask(block1 + 2u * sizeof(__m256i), block2 + 2u * sizeof(__m256i)) << 8u |
+                              own_mismatch_mask(block1 + 3u * sizeof(__m256i), block2 + 3u * sizeof(__m256i)) << 12u;
+
+        if (mask && !own_write_notes(src2, index, mask, delta_record, delta_record_max_size, &delta_record_size))
+        {
+            *result = overflow;
+            return delta_record_size;
+        }
+    }
+
+    for (; (index + blocks_per_vector) <= block_count; index += blocks_per_vector)
+    {
+        const uint32_t mask = own_mismatch_mask(src1 + index * sizeof(block_t), src2 + index * sizeof(block_t));
+
+        if (mask && !own_write_notes(src2, index, mask, delta_record, delta_record_max_size, &delta_record_size))
+        {
+            *result = overflow;
+            return delta_record_size;
+        }
+    }
+
+    for (; index < block_count; ++index)
+    {
+        block_t block1;
+        block_t block2;
+
+        memcpy(&block1, src1 + index * sizeof(block_t), sizeof(block_t));
+        memcpy(&block2, src2 + index * sizeof(block_t), sizeof(block_t));
+
+        if (block1 != block2 && !own_write_notes(src2, index, 1u, delta_record, delta_record_max_size, &delta_record_size))
+        {
+            *result = overflow;
+            return delta_record_size;
+        }
+    }
+
+    *result = delta_record_size ? not_equal : equal;
+
+    return delta_record_size;
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+void dml_avx2_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size)
+{
+    const uint32_t vector_size = sizeof(__m256i);
+
+    uint32_t i = 0u;
+
+    // Source is read once for both destinations
+    for (; (i + 4u * vector_size) <= transfer_size; i += 4u * vector_size)
+    {
+        const __m256i y0 = _mm256_loadu_si256((const __m256i *)(src + i + 0u * vector_size));
+        const __m256i y1 = _mm256_loadu_si256((const __m256i *)(src + i + 1u * vector_size));
+        const __m256i y2 = _mm256_loadu_si256((const __m256i *)(src + i + 2u * vector_size));
+        const __m256i y3 = _mm256_loadu_si256((const __m256i *)(src + i + 3u * vector_size));
+
+        _mm256_storeu_si256((__m256i *)(dst1 + i + 0u * vector_size), y0);
+        _mm256_storeu_si256((__m256i *)(dst1 + i + 1u * vector_size), y1);
+        _mm256_storeu_si256((__m256i *)(dst1 + i + 2u * vector_size), y2);
+        _mm256_storeu_si256((__m256i *)(dst1 + i + 3u * vector_size), y3);
+
+        _mm256_storeu_si256((__m256i *)(dst2 + i + 0u * vector_size), y0);
+        _mm256_storeu_si256((__m256i *)(dst2 + i + 1u * vector_size), y1);
+        _mm256_storeu_si256((__m256i *)(dst2 + i + 2u * vector_size), y2);
+        _mm256_storeu_si256((__m256i *)(dst2 + i + 3u * vector_size), y3);
+    }
+
+    for (; (i + vector_size) <= transfer_size; i += vector_size)
+    {
+        const __m256i y0 = _mm256_loadu_si256((const __m256i *)(src + i));
+
+        _mm256_storeu_si256((__m256i *)(dst1 + i), y0);
+        _mm256_storeu_si256((__m256i *)(dst2 + i), y0);
+    }
+
+    for (; i < transfer_size; ++i)
+    {
+        dst1[i] = src[i];
+        dst2[i] = src[i];
+    }
+}
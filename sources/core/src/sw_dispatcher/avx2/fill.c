@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/**
+ * @brief Returns pattern as it is seen from the given byte offset of the destination
+ */
+static inline uint64_t own_rotate_pattern(uint64_t pattern, uint32_t offset)
+{
+    const uint32_t shift = (offset % sizeof(pattern)) * 8u;
+
+    return (0u == shift) ? pattern : ((pattern >> shift) | (pattern << (64u - shift)));
+}
+
+static inline void own_fill_small(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint32_t chunk_size = sizeof(pattern);
+
+    uint32_t offset = 0u;
+
+    for (; offset + chunk_size <= transfer_size; offset += chunk_size)
+    {
+        memcpy(dst + offset, &pattern, chunk_size);
+    }
+
+    memcpy(dst + offset, &pattern, transfer_size - offset);
+}
+
+void dml_avx2_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint32_t vector_size = sizeof(__m256i);
+
+    if (transfer_size < vector_size)
+    {
+        own_fill_small(pattern, dst, transfer_size);
+        return;
+    }
+
+    const __m256i head = _mm256_set1_epi64x((long long)pattern);
+
+    // The first unaligned vector, then aligned vectors with the pattern shifted accordingly
+    _mm256_storeu_si256((__m256i *)dst, head);
+
+    const uint32_t offset  = vector_size - (uint32_t)((uintptr_t)dst & (vector_size - 1u));
+    const __m256i  aligned = _mm256_set1_epi64x((long long)own_rotate_pattern(pattern, offset));
+
+    uint8_t *const dst_end = dst + transfer_size - vector_size;
+    uint8_t       *dst_ptr = dst + offset;
+
+    while (dst_ptr + 4u * vector_size <= dst_end)
+    {
+        _mm256_store_si256((__m256i *)(dst_ptr + 0u * vector_size), aligned);
+        _mm256_store_si256((__m256i *)(dst_ptr + 1u * vector_size), aligned);
+        _mm256_store_si256((__m256i *)(dst_ptr + 2u * vector_size), aligned);
+        _mm256_store_si256((__m256i *)(dst_ptr + 3u * vector_size), aligned);
+
+        dst_ptr += 4u * vector_size;
+    }
+
+    while (dst_ptr < dst_end)
+    {
+        _mm256_store_si256((__m256i *)dst_ptr, aligned);
+
+        dst_ptr += vector_size;
+    }
+
+    // The last unaligned vector
+    const __m256i tail = _mm256_set1_epi64x((long long)own_rotate_pattern(pattern, transfer_size - vector_size));
+
+    _mm256_storeu_si256((__m256i *)dst_end, tail);
+}
+
+void dml_avx2_fill_nt_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint32_t vector_size = sizeof(__m256i);
+
+    if (transfer_size < 2u * vector_size)
+    {
+        dml_avx2_fill_u64(pattern, dst, transfer_size);
+        return;
+    }
+
+    _mm256_storeu_si256((__m256i *)dst, _mm256_set1_epi64x((long long)pattern));
+
+    const uint32_t offset  = vector_size - (uint32_t)((uintptr_t)dst & (vector_size - 1u));
+    const __m256i  aligned = _mm256_set1_epi64x((long long)own_rotate_pattern(pattern, offset));
+
+    uint8_t *const dst_end = dst + transfer_size - vector_size;
+    uint8_t       *dst_ptr = dst + offset;
+
+    while (dst_ptr + 4u * vector_size <= dst_end)
+    {
+        _mm256_stream_si256((__m256i *)(dst_ptr + 0u * vector_size), aligned);
+        _mm256_stream_si256((__m256i *)(dst_ptr + 1u * vector_size), aligned);
+        _mm256_stream_si256((__m256i *)(dst_ptr + 2u * vector_size), aligned);
+        _mm256_stream_si256((__m256i *)(dst_ptr + 3u * vector_size), aligned);
+
+        dst_ptr += 4u * vector_size;
+    }
+
+    while (dst_ptr < dst_end)
+    {
+        _mm256_stream_si256((__m256i *)dst_ptr, aligned);
+
+        dst_ptr += vector_size;
+    }
+
+    _mm_sfence();
+
+    const __m256i tail = _mm256_set1_epi64x((long long)own_rotate_pattern(pattern, transfer_size - vector_size));
+
+    _mm256_storeu_si256((__m256i *)dst_end, tail);
+}
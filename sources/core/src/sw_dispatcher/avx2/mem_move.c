@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/**
+ * @brief Copies up to 32 bytes. All loads are done before stores, so any overlap is allowed.
+ */
+static inline void own_copy_small(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    if (transfer_size >= 16u)
+    {
+        const __m128i head = _mm_loadu_si128((const __m128i *)src);
+        const __m128i tail = _mm_loadu_si128((const __m128i *)(src + transfer_size - 16u));
+
+        _mm_storeu_si128((__m128i *)dst, head);
+        _mm_storeu_si128((__m128i *)(dst + transfer_size - 16u), tail);
+    }
+    else if (transfer_size >= 8u)
+    {
+        uint64_t head;
+        uint64_t tail;
+
+        memcpy(&head, src, sizeof(head));
+        memcpy(&tail, src + transfer_size - 8u, sizeof(tail));
+        memcpy(dst, &head, sizeof(head));
+        memcpy(dst + transfer_size - 8u, &tail, sizeof(tail));
+    }
+    else if (transfer_size >= 4u)
+    {
+        uint32_t head;
+        uint32_t tail;
+
+        memcpy(&head, src, sizeof(head));
+        memcpy(&tail, src + transfer_size - 4u, sizeof(tail));
+        memcpy(dst, &head, sizeof(head));
+        memcpy(dst + transfer_size - 4u, &tail, sizeof(tail));
+    }
+    else if (transfer_size > 0u)
+    {
+        const uint8_t first  = src[0];
+        const uint8_t middle = src[transfer_size / 2u];
+        const uint8_t last   = src[transfer_size - 1u];
+
+        dst[0]                  = first;
+        dst[transfer_size / 2u] = middle;
+        dst[transfer_size - 1u] = last;
+    }
+}
+
+/**
+ * @brief Copies more than 32 bytes from lower to higher addresses, safe if dst is below src
+ *
+ * The first and the last 32 bytes are loaded in advance, the rest is stored to aligned destination.
+ */
+static inline void own_copy_forward(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    const __m256i head = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i tail = _mm256_loadu_si256((const __m256i *)(src + transfer_size - 32u));
+
+    uint8_t *const dst_end = dst + transfer_size - 32u;
+
+    const uint32_t offset = 32u - (uint32_t)((uintptr_t)dst & 31u);
+
+    const uint8_t *src_ptr = src + offset;
+    uint8_t       *dst_ptr = dst + offset;
+
+    while (dst_ptr + 128u <= dst_end)
+    {
+        const __m256i y0 = _mm256_loadu_si256((const __m256i *)(src_ptr + 0u));
+        const __m256i y1 = _mm256_loadu_si256((const __m256i *)(src_ptr + 32u));
+        const __m256i y2 = _mm256_loadu_si256((const __m256i *)(src_ptr + 64u));
+        const __m256i y3 = _mm256_loadu_si256((const __m256i *)(src_ptr + 96u));
+
+        _mm256_store_si256((__m256i *)(dst_ptr + 0u), y0);
+        _mm256_store_si256((__m256i *)(dst_ptr + 32u), y1);
+        _mm256_store_si256((__m256i *)(dst_ptr + 64u), y2);
+        _mm256_store_si256((__m256i *)(dst_ptr + 96u), y3);
+
+        src_ptr += 128u;
+        dst_ptr += 128u;
+    }
+
+    while (dst_ptr < dst_end)
+    {
+        _mm256_store_si256((__m256i *)dst_ptr, _mm256_loadu_si256((const __m256i *)src_ptr));
+
+        src_ptr += 32u;
+        dst_ptr += 32u;
+    }
+
+    _mm256_storeu_si256((__m256i *)dst, head);
+    _mm256_storeu_si256((__m256i *)dst_end, tail);
+}
+
+/**
+ * @brief Copies more than 32 bytes from higher to lower addresses, safe if dst is above src
+ */
+static inline void own_copy_backward(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    const __m256i head = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i tail = _mm256_loadu_si256((const __m256i *)(src + transfer_size - 32u));
+
+    uint8_t *const dst_end = dst + transfer_size;
+
+    const uint32_t offset = (uint32_t)((uintptr_t)dst_end & 31u);
+
+    const uint8_t *src_ptr = src + transfer_size - offset;
+    uint8_t       *dst_ptr = dst_end - offset;
+
+    while (dst_ptr >= dst + 32u + 128u)
+    {
+        const __m256i y0 = _mm256_loadu_si256((const __m256i *)(src_ptr - 32u));
+        const __m256i y1 = _mm256_loadu_si256((const __m256i *)(src_ptr - 64u));
+        const __m256i y2 = _mm256_loadu_si256((const __m256i *)(src_ptr - 96u));
+        const __m256i y3 = _mm256_loadu_si256((const __m256i *)(src_ptr - 128u));
+
+        _mm256_store_si256((__m256i *)(dst_ptr - 32u), y0);
+        _mm256_store_si256((__m256i *)(dst_ptr - 64u), y1);
+        _mm256_store_si256((__m256i *)(dst_ptr - 96u), y2);
+        _mm256_store_si256((__m256i *)(dst_ptr - 128u), y3);
+
+        src_ptr -= 128u;
+        dst_ptr -= 128u;
+    }
+
+    while (dst_ptr > dst + 32u)
+    {
+        src_ptr -= 32u;
+        dst_ptr -= 32u;
+
+        _mm256_store_si256((__m256i *)dst_ptr, _mm256_loadu_si256((const __m256i *)src_ptr));
+    }
+
+    _mm256_storeu_si256((__m256i *)(dst_end - 32u), tail);
+    _mm256_storeu_si256((__m256i *)dst, head);
+}
+
+void dml_avx2_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    if (src == dst)
+    {
+        return;
+    }
+
+    if (transfer_size <= 32u)
+    {
+        own_copy_small(src, dst, transfer_size);
+    }
+    /*
+     * src:     |-------|
+     * dst: |-------|
+     *
+     * OR no overlapping
+     *
+     * Forward copy is applicable
+     */
+    else if (dst < src || dst >= src + transfer_size)
+    {
+        own_copy_forward(src, dst, transfer_size);
+    }
+    /*
+     * src: |-------|
+     * dst:     |-------|
+     *
+     * Only backward copy is applicable
+     */
+    else
+    {
+        own_copy_backward(src, dst, transfer_size);
+    }
+}
+
+void dml_avx2_mem_move_nt(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint32_t vector_size = sizeof(__m256i);
+
+    // Streaming stores are used for disjoint buffers only, everything else goes the regular way
+    if (transfer_size < 2u * vector_size || (dst < src + transfer_size && src < dst + transfer_size))
+    {
+        dml_avx2_mem_move(src, dst, transfer_size);
+        return;
+    }
+
+    const __m256i head = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i tail = _mm256_loadu_si256((const __m256i *)(src + transfer_size - vector_size));
+
+    uint8_t *const dst_end = dst + transfer_size - vector_size;
+
+    const uint32_t offset = vector_size - (uint32_t)((uintptr_t)dst & (vector_size - 1u));
+
+    const uint8_t *src_ptr = src + offset;
+    uint8_t       *dst_ptr = dst + offset;
+
+    _mm256_storeu_si256((__m256i *)dst, head);
+
+    while (dst_ptr + 4u * vector_size <= dst_end)
+    {
+        const __m256i y0 = _mm256_loadu_si256((const __m256i *)(src_ptr + 0u * vector_size));
+        const __m256i y1 = _mm256_loadu_si256((const __m256i *)(src_ptr + 1u * vector_size));
+        const __m256i y2 = _mm256_loadu_si256((const __m256i *)(src_ptr + 2u * vector_size));
+        const __m256i y3 = _mm256_loadu_si256((const __m256i *)(src_ptr + 3u * vector_size));
+
+        _mm256_stream_si256((__m256i *)(dst_ptr + 0u * vector_size), y0);
+        _mm256_stream_si256((__m256i *)(dst_ptr + 1u * vector_size), y1);
+        _mm256_stream_si256((__m256i *)(dst_ptr + 2u * vector_size), y2);
+        _mm256_stream_si256((__m256i *)(dst_ptr + 3u * vector_size), y3);
+
+        src_ptr += 4u * vector_size;
+        dst_ptr += 4u * vector_size;
+    }
+
+    while (dst_ptr < dst_end)
+    {
+        _mm256_stream_si256((__m256i *)dst_ptr, _mm256_loadu_si256((const __m256i *)src_ptr));
+
+        src_ptr += vector_size;
+        dst_ptr += vector_size;
+    }
+
+    // Streaming stores are weakly ordered, so they are fenced before the tail and before the caller writes anything
+    _mm_sfence();
+
+    _mm256_storeu_si256((__m256i *)dst_end, tail);
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+#if defined(_MSC_VER)
+#define OWN_ALIGNED_64_ARRAY(array_declaration) __declspec(align(64u)) array_declaration
+#elif defined(__GNUC__)
+#define OWN_ALIGNED_64_ARRAY(array_declaration) array_declaration __attribute__((aligned(64u)))
+#endif
+
+#define OWN_DELTA_NOTE_SIZE   10u
+#define OWN_NOTES_PER_VECTOR  8u
+#define OWN_NOTES_VECTOR_SIZE (OWN_NOTES_PER_VECTOR * OWN_DELTA_NOTE_SIZE)
+
+/*
+ * Delta note is 5 words: offset and 4 words of data. Permutation indices take offsets and data
+ * of 8 notes from the stream of 40 words.
+ */
+OWN_ALIGNED_64_ARRAY(static const uint16_t own_offsets_idx[32]) = { 0, 5, 10, 15, 20, 25, 30, 35 };
+OWN_ALIGNED_64_ARRAY(static const uint16_t own_blocks_idx[32])  = { 1,  2,  3,  4,  6,  7,  8,  9,  11, 12, 13,
+                                                                    14, 16, 17, 18, 19, 21, 22, 23, 24, 26, 27,
+                                                                    28, 29, 31, 32, 33, 34, 36, 37, 38, 39 };
+
+/**
+ * @brief Returns mask of the first size bytes of a vector
+ */
+static inline __mmask64 own_bytes_mask(uint32_t size)
+{
+    return (size < 64u) ? (__mmask64)(((uint64_t)1u << size) - 1u) : (__mmask64)~(uint64_t)0u;
+}
+
+/**
+ * @brief Applies up to 8 notes, stream words are split between two vectors
+ */
+static inline void own_apply_notes(__m512i first, __m512i second, __mmask8 notes_mask, uint8_t *dst)
+{
+    const __m512i offsets = _mm512_cvtepu16_epi64(_mm512_castsi512_si128(_mm512_permutex2var_epi16(first, _mm512_load_si512(own_offsets_idx), second)));
+    const __m512i blocks  = _mm512_permutex2var_epi16(first, _mm512_load_si512(own_blocks_idx), second);
+
+    // Scatter writes to the same address are ordered from the lowest lane, so the last note wins as in the reference kernel
+    _mm512_mask_i64scatter_epi64(dst, notes_mask, offsets, blocks, 8);
+}
+
+void dml_avx512_apply_delta(const uint8_t *delta_record, uint8_t *dst, uint32_t delta_record_size)
+{
+    const uint32_t delta_notes_count = delta_record_size / OWN_DELTA_NOTE_SIZE;
+
+    uint32_t index = 0u;
+
+    for (; (index + OWN_NOTES_PER_VECTOR) <= delta_notes_count; index += OWN_NOTES_PER_VECTOR)
+    {
+        const uint8_t *const delta_notes = delta_record + index * OWN_DELTA_NOTE_SIZE;
+
+        const __m512i first  = _mm512_loadu_si512(delta_notes);
+        const __m512i second = _mm512_maskz_loadu_epi8(own_bytes_mask(OWN_NOTES_VECTOR_SIZE - 64u), delta_notes + 64u);
+
+        own_apply_notes(first, second, (__mmask8)0xFFu, dst);
+    }
+
+    if (index < delta_notes_count)
+    {
+        const uint8_t *const delta_notes = delta_record + index * OWN_DELTA_NOTE_SIZE;
+
+        const uint32_t remaining = delta_notes_count - index;
+        const uint32_t size      = remaining * OWN_DELTA_NOTE_SIZE;
+
+        // Tail is shorter than 8 notes, so it never reaches the second vector beyond 16 bytes
+        const __m512i first  = _mm512_maskz_loadu_epi8(own_bytes_mask(size), delta_notes);
+        const __m512i second = (size > 64u) ? _mm512_maskz_loadu_epi8(own_bytes_mask(size - 64u), delta_notes + 64u) : _mm512_setzero_si512();
+
+        own_apply_notes(first, second, (__mmask8)((1u << remaining) - 1u), dst);
+    }
+}
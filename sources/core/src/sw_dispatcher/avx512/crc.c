@@ -15,7 +15,14 @@
 #error "Unsupported compiler"
 #endif
 
+#if defined(_MSC_BUILD)
+#define OWN_THREAD_LOCAL __declspec(thread)
+#else
+#define OWN_THREAD_LOCAL _Thread_local
+#endif
+
 #define D_POLYNOMIAL_1 0x1EDC6F41
+#define OWN_CACHED_POLYNOMIALS 4u /**< Polynomials with generated constants kept per thread */
 
  /**
  *  @todo
@@ -170,6 +177,34 @@ static inline void own_gen_crc_opt_poly_8u(uint64_t poly, uint8_t optPoly[128])
     }
 }
 
+/**
+ * @brief Returns constants for the given polynomial, generated ones are cached for the last few used polynomials
+ */
+static inline const uint8_t* own_get_crc_opt_poly_8u(uint64_t poly)
+{
+    static OWN_THREAD_LOCAL uint64_t cached_opt_poly[OWN_CACHED_POLYNOMIALS][128u / sizeof(uint64_t)];
+    static OWN_THREAD_LOCAL uint64_t cached_polys[OWN_CACHED_POLYNOMIALS];
+    static OWN_THREAD_LOCAL uint32_t cached_count;
+    static OWN_THREAD_LOCAL uint32_t next_entry;
+
+    for (uint32_t entry = 0u; entry < cached_count; ++entry) {
+        if (cached_polys[entry] == poly) {
+            return (const uint8_t*)cached_opt_poly[entry];
+        }
+    }
+
+    // Entries are replaced in the order they were filled
+    const uint32_t entry = next_entry;
+
+    own_gen_crc_opt_poly_8u(poly, (uint8_t*)cached_opt_poly[entry]);
+    cached_polys[entry] = poly;
+
+    next_entry   = (entry + 1u) % OWN_CACHED_POLYNOMIALS;
+    cached_count = (cached_count < OWN_CACHED_POLYNOMIALS) ? cached_count + 1u : cached_count;
+
+    return (const uint8_t*)cached_opt_poly[entry];
+}
+
 static inline void dmlc_own_calculate_crc_32u(const uint8_t* const memory_region_ptr,
     uint32_t             bytes_to_hash,
     uint32_t* const      crc_ptr,
@@ -180,10 +215,12 @@ static inline void dmlc_own_calculate_crc_32u(const uint8_t* const memory_region
     if (D_POLYNOMIAL_1 == polynomial) {
         own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_1_ptr, *crc_ptr, crc_ptr);
     }
+    else if (bytes_to_hash >= 1024u) {
+        // Folding kernel generates constants for any polynomial and caches them
+        *crc_ptr = dml_avx2_crc_u32(memory_region_ptr, bytes_to_hash, *crc_ptr, polynomial);
+    }
     else {
-        uint8_t opt_poly_ptr[128];
-        own_gen_crc_opt_poly_8u(poly, opt_poly_ptr);
-        own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_ptr, *crc_ptr, crc_ptr);
+        own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, own_get_crc_opt_poly_8u(poly), *crc_ptr, crc_ptr);
     }
 }
 
@@ -197,10 +234,12 @@ static inline void dmlc_own_calculate_crc_reflected_32u(const uint8_t* const mem
     if (D_POLYNOMIAL_1 == polynomial) {
         own_CRC_reflected_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_1_ptr, *crc_ptr, crc_ptr);
     }
+    else if (bytes_to_hash >= 1024u) {
+        // Folding kernel generates constants for any polynomial and caches them
+        *crc_ptr = dml_avx2_crc_reflected_u32(memory_region_ptr, bytes_to_hash, *crc_ptr, polynomial);
+    }
     else {
-        uint8_t opt_poly_ptr[128];
-        own_gen_crc_opt_poly_8u(poly, opt_poly_ptr);
-        own_CRC_reflected_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_ptr, *crc_ptr, crc_ptr);
+        own_CRC_reflected_8u_k0(memory_region_ptr, bytes_to_hash, poly, own_get_crc_opt_poly_8u(poly), *crc_ptr, crc_ptr);
     }
 }
 
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ * CRC16 T10 DIF with VPCLMULQDQ folding.
+ *
+ * CRC16 is calculated as CRC32 with the polynomial P * x^16, so the CRC value is placed into the high
+ * 16 bits of the CRC32 state and the low bits stay zero. Four 512-bit registers fold 256 bytes per
+ * iteration, the rest of the message is processed by the PCLMULQDQ kernel.
+ */
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+#define OWN_FOLD_BLOCK_SIZE 256u
+
+/** Folding constants are x^(T+64) mod (P * x^16) and x^T mod (P * x^16), from the high half of a lane */
+#define OWN_FOLD_2048 0xC9EB0000u, 0xEFE20000u
+#define OWN_FOLD_512  0x371D0000u, 0x87E70000u
+#define OWN_FOLD_384  0xAADB0000u, 0x1F990000u
+#define OWN_FOLD_256  0xD8B30000u, 0xBE6C0000u
+#define OWN_FOLD_128  0x4C1A0000u, 0xFB0B0000u
+
+#define OWN_REDUCE_96      0x2D560000u
+#define OWN_REDUCE_64      0x13680000u
+#define OWN_BARRETT_MU     0x1F65A57F8u
+#define OWN_BARRETT_POLY   0x18BB70000u
+
+static inline __m512i own_load_be(const uint8_t *src)
+{
+    const __m512i byte_swap = _mm512_broadcast_i32x4(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+
+    return _mm512_shuffle_epi8(_mm512_loadu_si512(src), byte_swap);
+}
+
+static inline __m512i own_fold(__m512i value, __m512i constants)
+{
+    return _mm512_xor_si512(_mm512_clmulepi64_epi128(value, constants, 0x00), _mm512_clmulepi64_epi128(value, constants, 0x11));
+}
+
+/**
+ * @brief Returns (value * x^32) mod (P * x^16)
+ */
+static inline uint32_t own_reduce_128(__m128i value)
+{
+    const __m128i reduce  = _mm_set_epi64x(OWN_REDUCE_64, OWN_REDUCE_96);
+    const __m128i barrett = _mm_set_epi64x((long long)OWN_BARRETT_POLY, (long long)OWN_BARRETT_MU);
+
+    // 128 -> 96 bits: high * (x^96 mod P) + low * x^32
+    value = _mm_xor_si128(_mm_clmulepi64_si128(value, reduce, 0x01), _mm_slli_si128(_mm_move_epi64(value), 4));
+
+    // 96 -> 64 bits: high * (x^64 mod P) + low
+    value = _mm_xor_si128(_mm_clmulepi64_si128(value, reduce, 0x11), _mm_move_epi64(value));
+
+    // Barrett reduction
+    __m128i quotient = _mm_clmulepi64_si128(_mm_srli_epi64(value, 32), barrett, 0x00);
+    quotient         = _mm_srli_epi64(quotient, 32);
+
+    value = _mm_xor_si128(value, _mm_clmulepi64_si128(quotient, barrett, 0x10));
+
+    return (uint32_t)_mm_cvtsi128_si32(value);
+}
+
+uint16_t dml_avx512_crc16_t10dif(const uint8_t *src, uint32_t transfer_size, uint16_t crc_value)
+{
+    if (transfer_size < OWN_FOLD_BLOCK_SIZE)
+    {
+        return dml_avx2_crc16_t10dif(src, transfer_size, crc_value);
+    }
+
+    const __m512i fold_2048 = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_FOLD_2048));
+    const __m512i fold_512  = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_FOLD_512));
+
+    __m512i value0 = own_load_be(src + 0u);
+    __m512i value1 = own_load_be(src + 64u);
+    __m512i value2 = own_load_be(src + 128u);
+    __m512i value3 = own_load_be(src + 192u);
+
+    // CRC is the highest 16 bits of the message
+    value0 = _mm512_xor_si512(value0, _mm512_castsi128_si512(_mm_set_epi32((int)((uint32_t)crc_value << 16u), 0, 0, 0)));
+
+    uint32_t offset = OWN_FOLD_BLOCK_SIZE;
+
+    for (; (offset + OWN_FOLD_BLOCK_SIZE) <= transfer_size; offset += OWN_FOLD_BLOCK_SIZE)
+    {
+        value0 = _mm512_xor_si512(own_fold(value0, fold_2048), own_load_be(src + offset + 0u));
+        value1 = _mm512_xor_si512(own_fold(value1, fold_2048), own_load_be(src + offset + 64u));
+        value2 = _mm512_xor_si512(own_fold(value2, fold_2048), own_load_be(src + offset + 128u));
+        value3 = _mm512_xor_si512(own_fold(value3, fold_2048), own_load_be(src + offset + 192u));
+    }
+
+    value0 = _mm512_xor_si512(own_fold(value0, fold_512), value1);
+    value0 = _mm512_xor_si512(own_fold(value0, fold_512), value2);
+    value0 = _mm512_xor_si512(own_fold(value0, fold_512), value3);
+
+    for (; (offset + sizeof(__m512i)) <= transfer_size; offset += (uint32_t)sizeof(__m512i))
+    {
+        value0 = _mm512_xor_si512(own_fold(value0, fold_512), own_load_be(src + offset));
+    }
+
+    // Lanes go from the highest degree, each is folded to the last one
+    const __m512i fold_lanes = _mm512_set_epi64(0, 0, OWN_FOLD_128, OWN_FOLD_256, OWN_FOLD_384);
+    const __m512i folded     = _mm512_mask_blend_epi64(0xC0u, own_fold(value0, fold_lanes), value0);
+
+    const __m128i value = _mm_xor_si128(_mm_xor_si128(_mm512_extracti64x2_epi64(folded, 0), _mm512_extracti64x2_epi64(folded, 1)),
+                                        _mm_xor_si128(_mm512_extracti64x2_epi64(folded, 2), _mm512_extracti64x2_epi64(folded, 3)));
+
+    crc_value = (uint16_t)(own_reduce_128(value) >> 16u);
+
+    return dml_avx2_crc16_t10dif(src + offset, transfer_size - offset, crc_value);
+}
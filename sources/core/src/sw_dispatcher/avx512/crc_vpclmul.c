@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ * CRC32 with VPCLMULQDQ folding.
+ *
+ * Four 512-bit registers fold 256 bytes per iteration, which is four times more lanes per instruction
+ * than the PCLMULQDQ kernel has. The lanes are folded into a single 128-bit value, which is the message
+ * block with the same CRC as the processed part. So the value is passed to the PCLMULQDQ kernel
+ * together with the rest of the message, and the reduction is not repeated here.
+ *
+ * Reflected CRC is folded in bit-reversed registers as in the PCLMULQDQ kernel, data is loaded as is
+ * and the constants are bit-reversed x^(T-1) mod P placed into the high half of 64-bit lane.
+ *
+ * Constants are precalculated for CRC32C, other polynomials are processed by the PCLMULQDQ kernel.
+ */
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+#define OWN_DEFAULT_POLYNOMIAL 0x1EDC6F41u
+#define OWN_FOLD_BLOCK_SIZE    256u
+
+/** Folding constants are x^(T+64) mod P and x^T mod P, from the high half of a lane */
+#define OWN_FOLD_2048 0xFA374B2Eu, 0x4EF6A711u
+#define OWN_FOLD_512  0xA6955F31u, 0xAA97D41Du
+#define OWN_FOLD_384  0xAA5EEC4Au, 0xE6957B4Du
+#define OWN_FOLD_256  0x7BBA6798u, 0x59A3508Au
+#define OWN_FOLD_128  0x6503EA99u, 0x18571D18u
+
+/** Reflected folding constants are reversed x^(T-1) mod P and x^(T+63) mod P, from the high half of a lane */
+#define OWN_FOLD_2048_REFLECTED 0x1426A81500000000u, 0xE9A5D8BE00000000u
+#define OWN_FOLD_512_REFLECTED  0x75BBA45B00000000u, 0x1C19243B00000000u
+#define OWN_FOLD_384_REFLECTED  0x6051243F00000000u, 0xA46EF4AA00000000u
+#define OWN_FOLD_256_REFLECTED  0xA2158B3400000000u, 0x33CCBBBC00000000u
+#define OWN_FOLD_128_REFLECTED  0x3171D43000000000u, 0x3743F7BD00000000u
+
+static inline uint32_t own_reverse_32u(uint32_t value)
+{
+    value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
+    value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
+    value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
+    value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
+    value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
+
+    return value;
+}
+
+static inline __m512i own_broadcast(uint64_t high, uint64_t low)
+{
+    return _mm512_broadcast_i32x4(_mm_set_epi64x((long long)high, (long long)low));
+}
+
+static inline __m512i own_load(const uint8_t *src, int reflected)
+{
+    const __m512i block     = _mm512_loadu_si512(src);
+    const __m512i byte_swap = _mm512_broadcast_i32x4(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+
+    return reflected ? block : _mm512_shuffle_epi8(block, byte_swap);
+}
+
+static inline __m512i own_fold(__m512i value, __m512i constants)
+{
+    return _mm512_xor_si512(_mm512_clmulepi64_epi128(value, constants, 0x00), _mm512_clmulepi64_epi128(value, constants, 0x11));
+}
+
+/**
+ * @brief Folds the whole 64-byte blocks of the message, returns the number of processed bytes
+ */
+static inline uint32_t own_crc_fold(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, int reflected, uint8_t folded[16])
+{
+    const __m512i fold_2048 = reflected ? own_broadcast(OWN_FOLD_2048_REFLECTED) : own_broadcast(OWN_FOLD_2048);
+    const __m512i fold_512  = reflected ? own_broadcast(OWN_FOLD_512_REFLECTED) : own_broadcast(OWN_FOLD_512);
+
+    __m512i value0 = own_load(src + 0u, reflected);
+    __m512i value1 = own_load(src + 64u, reflected);
+    __m512i value2 = own_load(src + 128u, reflected);
+    __m512i value3 = own_load(src + 192u, reflected);
+
+    // CRC is the highest 32 bits of the message
+    const __m128i crc = reflected ? _mm_cvtsi32_si128((int)own_reverse_32u(crc_value)) : _mm_set_epi32((int)crc_value, 0, 0, 0);
+
+    value0 = _mm512_xor_si512(value0, _mm512_castsi128_si512(crc));
+
+    uint32_t offset = OWN_FOLD_BLOCK_SIZE;
+
+    for (; (offset + OWN_FOLD_BLOCK_SIZE) <= transfer_size; offset += OWN_FOLD_BLOCK_SIZE)
+    {
+        value0 = _mm512_xor_si512(own_fold(value0, fold_2048), own_load(src + offset + 0u, reflected));
+        value1 = _mm512_xor_si512(own_fold(value1, fold_2048), own_load(src + offset + 64u, reflected));
+        value2 = _mm512_xor_si512(own_fold(value2, fold_2048), own_load(src + offset + 128u, reflected));
+        value3 = _mm512_xor_si512(own_fold(value3, fold_2048), own_load(src + offset + 192u, reflected));
+    }
+
+    value0 = _mm512_xor_si512(own_fold(value0, fold_512), value1);
+    value0 = _mm512_xor_si512(own_fold(value0, fold_512), value2);
+    value0 = _mm512_xor_si512(own_fold(value0, fold_512), value3);
+
+    for (; (offset + sizeof(__m512i)) <= transfer_size; offset += (uint32_t)sizeof(__m512i))
+    {
+        value0 = _mm512_xor_si512(own_fold(value0, fold_512), own_load(src + offset, reflected));
+    }
+
+    // Lanes go from the highest degree, each is folded to the last one
+    const __m512i fold_lanes = reflected ? _mm512_set_epi64(0, 0, OWN_FOLD_128_REFLECTED, OWN_FOLD_256_REFLECTED, OWN_FOLD_384_REFLECTED)
+                                         : _mm512_set_epi64(0, 0, OWN_FOLD_128, OWN_FOLD_256, OWN_FOLD_384);
+    const __m512i lanes      = _mm512_mask_blend_epi64(0xC0u, own_fold(value0, fold_lanes), value0);
+
+    __m128i value = _mm_xor_si128(_mm_xor_si128(_mm512_extracti64x2_epi64(lanes, 0), _mm512_extracti64x2_epi64(lanes, 1)),
+                                  _mm_xor_si128(_mm512_extracti64x2_epi64(lanes, 2), _mm512_extracti64x2_epi64(lanes, 3)));
+
+    if (!reflected)
+    {
+        value = _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    }
+
+    _mm_storeu_si128((__m128i *)folded, value);
+
+    return offset;
+}
+
+uint32_t dml_avx512_vpclmul_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    if (OWN_DEFAULT_POLYNOMIAL != polynomial || transfer_size < OWN_FOLD_BLOCK_SIZE)
+    {
+        return dml_avx2_crc_u32(src, transfer_size, crc_value, polynomial);
+    }
+
+    uint8_t folded[16];
+
+    const uint32_t offset = own_crc_fold(src, transfer_size, crc_value, 0, folded);
+
+    crc_value = dml_avx2_crc_u32(folded, sizeof(folded), 0u, polynomial);
+
+    return dml_avx2_crc_u32(src + offset, transfer_size - offset, crc_value, polynomial);
+}
+
+uint32_t dml_avx512_vpclmul_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    if (OWN_DEFAULT_POLYNOMIAL != polynomial || transfer_size < OWN_FOLD_BLOCK_SIZE)
+    {
+        return dml_avx2_crc_reflected_u32(src, transfer_size, crc_value, polynomial);
+    }
+
+    uint8_t folded[16];
+
+    const uint32_t offset = own_crc_fold(src, transfer_size, crc_value, 1, folded);
+
+    crc_value = dml_avx2_crc_reflected_u32(folded, sizeof(folded), 0u, polynomial);
+
+    return dml_avx2_crc_reflected_u32(src + offset, transfer_size - offset, crc_value, polynomial);
+}
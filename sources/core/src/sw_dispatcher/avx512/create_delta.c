@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+#if defined(_MSC_VER)
+#define OWN_ALIGNED_64_ARRAY(array_declaration) __declspec(align(64u)) array_declaration
+#elif defined(__GNUC__)
+#define OWN_ALIGNED_64_ARRAY(array_declaration) array_declaration __attribute__((aligned(64u)))
+#endif
+
+#define OWN_DELTA_NOTE_SIZE   10u
+#define OWN_BLOCKS_PER_VECTOR 8u
+
+/*
+ * Delta note is 5 words: offset and 4 words of data. Permutation indices build the stream of 8 notes
+ * from packed data (indices 0-31) and packed offsets (indices 32-39).
+ */
+OWN_ALIGNED_64_ARRAY(static const uint16_t own_notes_first_idx[32]) = { 32, 0,  1,  2,  3,  33, 4,  5,  6,  7,  34,
+                                                                        8,  9,  10, 11, 35, 12, 13, 14, 15, 36, 16,
+                                                                        17, 18, 19, 37, 20, 21, 22, 23, 38, 24 };
+OWN_ALIGNED_64_ARRAY(static const uint16_t own_notes_second_idx[32]) = { 25, 26, 27, 39, 28, 29, 30, 31 };
+
+/**
+ * @brief Returns mask of the first size bytes of a vector
+ */
+static inline __mmask64 own_bytes_mask(uint32_t size)
+{
+    return (size < 64u) ? (__mmask64)(((uint64_t)1u << size) - 1u) : (__mmask64)~(uint64_t)0u;
+}
+
+/**
+ * @brief Writes delta notes for the first notes_count set bits of the mask
+ */
+static inline void own_write_notes(__m512i blocks, __mmask8 mask, uint32_t first_block, uint32_t notes_count, uint8_t *delta_position)
+{
+    const __m512i indices = _mm512_add_epi64(_mm512_set1_epi64((long long)first_block), _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0));
+
+    // Mismatched blocks and their indices are packed to the beginning of the vectors
+    const __m512i packed_blocks  = _mm512_maskz_compress_epi64(mask, blocks);
+    const __m512i packed_offsets = _mm512_castsi128_si512(_mm512_cvtepi64_epi16(_mm512_maskz_compress_epi64(mask, indices)));
+
+    const __m512i first  = _mm512_permutex2var_epi16(packed_blocks, _mm512_load_si512(own_notes_first_idx), packed_offsets);
+    const __m512i second = _mm512_permutex2var_epi16(packed_blocks, _mm512_load_si512(own_notes_second_idx), packed_offsets);
+
+    const uint32_t size = notes_count * OWN_DELTA_NOTE_SIZE;
+
+    if (size <= sizeof(__m512i))
+    {
+        _mm512_mask_storeu_epi8(delta_position, own_bytes_mask(size), first);
+    }
+    else
+    {
+        _mm512_storeu_si512(delta_position, first);
+        _mm512_mask_storeu_epi8(delta_position + sizeof(__m512i), own_bytes_mask(size - (uint32_t)sizeof(__m512i)), second);
+    }
+}
+
+/**
+ * @brief Appends notes for one vector of blocks, returns zero if the delta record overflows
+ */
+static inline int own_append_notes(__m512i        blocks,
+                                   __mmask8       mask,
+                                   uint32_t       first_block,
+                                   uint8_t       *delta_record,
+                                   uint32_t       delta_record_max_size,
+                                   uint32_t      *delta_record_size)
+{
+    const uint32_t notes_count     = (uint32_t)_mm_popcnt_u32(mask);
+    const uint32_t available_notes = (delta_record_max_size - *delta_record_size) / OWN_DELTA_NOTE_SIZE;
+
+    // Notes which fit are still written, as the reference kernel does
+    const uint32_t written_notes = (notes_count < available_notes) ? notes_count : available_notes;
+
+    if (written_notes > 0u)
+    {
+        own_write_notes(blocks, mask, first_block, written_notes, delta_record + *delta_record_size);
+
+        *delta_record_size += written_notes * OWN_DELTA_NOTE_SIZE;
+    }
+
+    return written_notes == notes_count;
+}
+
+uint32_t dml_avx512_create_delta(const uint8_t *src1,
+                                 const uint8_t *src2,
+                                 uint32_t       transfer_size,
+                                 uint8_t       *delta_record,
+                                 uint32_t       delta_record_max_size,
+                                 uint8_t       *result)
+{
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+    const uint8_t overflow  = 0x2;
+
+    const uint64_t *const blocks1     = (const uint64_t *)src1;
+    const uint64_t *const blocks2     = (const uint64_t *)src2;
+    const uint32_t        block_count = transfer_size / (uint32_t)sizeof(uint64_t);
+
+    uint32_t delta_record_size = 0u;
+    uint32_t index             = 0u;
+
+    for (; (index + 4u * OWN_BLOCKS_PER_VECTOR) <= block_count; index += 4u * OWN_BLOCKS_PER_VECTOR)
+    {
+        __m512i  blocks[4];
+        __mmask8 masks[4];
+
+        for (uint32_t i = 0u; i < 4u; ++i)
+        {
+            const uint32_t first_block = index + i * OWN_BLOCKS_PER_VECTOR;
+
+            blocks[i] = _mm512_loadu_si512(blocks2 + first_block);
+            masks[i]  = _mm512_cmpneq_epi64_mask(_mm512_loadu_si512(blocks1 + first_block), blocks[i]);
+        }
+
+        // Most of the blocks are expected to be equal
+        if (0u == (masks[0] | masks[1] | masks[2] | masks[3]))
+        {
+            continue;
+        }
+
+        for (uint32_t i = 0u; i < 4u; ++i)
+        {
+            if (masks[i] &&
+                !own_append_notes(blocks[i], masks[i], index + i * OWN_BLOCKS_PER_VECTOR, delta_record, delta_record_max_size, &delta_record_size))
+            {
+                *result = overflow;
+                return delta_record_size;
+            }
+        }
+    }
+
+    for (; index < block_count; index += OWN_BLOCKS_PER_VECTOR)
+    {
+        const uint32_t remaining = block_count - index;
+        const __mmask8 load_mask = (remaining < OWN_BLOCKS_PER_VECTOR) ? (__mmask8)((1u << remaining) - 1u) : (__mmask8)0xFFu;
+
+        const __m512i  blocks = _mm512_maskz_loadu_epi64(load_mask, blocks2 + index);
+        const __mmask8 mask   = _mm512_mask_cmpneq_epi64_mask(load_mask, _mm512_maskz_loadu_epi64(load_mask, blocks1 + index), blocks);
+
+        if (mask && !own_append_notes(blocks, mask, index, delta_record, delta_record_max_size, &delta_record_size))
+        {
+            *result = overflow;
+            return delta_record_size;
+        }
+    }
+
+    *result = delta_record_size ? not_equal : equal;
+
+    return delta_record_size;
+}
@@ -99,3 +99,55 @@ void dml_avx512_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
     dml_ref_fill_u64(pattern, dst, transfer_size);
 }
 #endif
+
+/**
+ * @brief Returns pattern as it is seen from the given byte offset of the destination
+ */
+static inline uint64_t own_rotate_pattern(uint64_t pattern, uint32_t offset)
+{
+    const uint32_t shift = (offset % sizeof(pattern)) * 8u;
+
+    return (0u == shift) ? pattern : ((pattern >> shift) | (pattern << (64u - shift)));
+}
+
+void dml_avx512_fill_nt_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint32_t vector_size = sizeof(__m512i);
+
+    if (transfer_size < 2u * vector_size)
+    {
+        dml_avx512_fill_u64(pattern, dst, transfer_size);
+        return;
+    }
+
+    _mm512_storeu_si512(dst, _mm512_set1_epi64((long long)pattern));
+
+    const uint32_t offset  = vector_size - (uint32_t)((uintptr_t)dst & (vector_size - 1u));
+    const __m512i  aligned = _mm512_set1_epi64((long long)own_rotate_pattern(pattern, offset));
+
+    uint8_t *const dst_end = dst + transfer_size - vector_size;
+    uint8_t       *dst_ptr = dst + offset;
+
+    while (dst_ptr + 4u * vector_size <= dst_end)
+    {
+        _mm512_stream_si512((__m512i *)(dst_ptr + 0u * vector_size), aligned);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 1u * vector_size), aligned);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 2u * vector_size), aligned);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 3u * vector_size), aligned);
+
+        dst_ptr += 4u * vector_size;
+    }
+
+    while (dst_ptr < dst_end)
+    {
+        _mm512_stream_si512((__m512i *)dst_ptr, aligned);
+
+        dst_ptr += vector_size;
+    }
+
+    _mm_sfence();
+
+    const __m512i tail = _mm512_set1_epi64((long long)own_rotate_pattern(pattern, transfer_size - vector_size));
+
+    _mm512_storeu_si512(dst_end, tail);
+}
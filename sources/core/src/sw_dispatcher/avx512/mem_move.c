@@ -850,3 +850,56 @@ void dml_avx512_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_siz
         dml_ref_mem_move(src, dst, transfer_size);
     }
 }
+
+void dml_avx512_mem_move_nt(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint32_t vector_size = sizeof(__m512i);
+
+    // Streaming stores are used for disjoint buffers only, everything else goes the regular way
+    if (transfer_size < 2u * vector_size || (dst < src + transfer_size && src < dst + transfer_size))
+    {
+        dml_avx512_mem_move(src, dst, transfer_size);
+        return;
+    }
+
+    const __m512i head = _mm512_loadu_si512(src);
+    const __m512i tail = _mm512_loadu_si512(src + transfer_size - vector_size);
+
+    uint8_t *const dst_end = dst + transfer_size - vector_size;
+
+    const uint32_t offset = vector_size - (uint32_t)((uintptr_t)dst & (vector_size - 1u));
+
+    const uint8_t *src_ptr = src + offset;
+    uint8_t       *dst_ptr = dst + offset;
+
+    _mm512_storeu_si512(dst, head);
+
+    while (dst_ptr + 4u * vector_size <= dst_end)
+    {
+        const __m512i z0 = _mm512_loadu_si512(src_ptr + 0u * vector_size);
+        const __m512i z1 = _mm512_loadu_si512(src_ptr + 1u * vector_size);
+        const __m512i z2 = _mm512_loadu_si512(src_ptr + 2u * vector_size);
+        const __m512i z3 = _mm512_loadu_si512(src_ptr + 3u * vector_size);
+
+        _mm512_stream_si512((__m512i *)(dst_ptr + 0u * vector_size), z0);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 1u * vector_size), z1);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 2u * vector_size), z2);
+        _mm512_stream_si512((__m512i *)(dst_ptr + 3u * vector_size), z3);
+
+        src_ptr += 4u * vector_size;
+        dst_ptr += 4u * vector_size;
+    }
+
+    while (dst_ptr < dst_end)
+    {
+        _mm512_stream_si512((__m512i *)dst_ptr, _mm512_loadu_si512(src_ptr));
+
+        src_ptr += vector_size;
+        dst_ptr += vector_size;
+    }
+
+    // Streaming stores are weakly ordered, so they are fenced before the tail and before the caller writes anything
+    _mm_sfence();
+
+    _mm512_storeu_si512(dst_end, tail);
+}
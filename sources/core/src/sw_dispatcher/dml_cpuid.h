@@ -15,8 +15,16 @@ typedef unsigned dml_register_t;
 
 #include <stddef.h>
 
+#define DML_CPUID_FEATURES   0x1
 #define DML_CPUID_EXTENSIONS 0x7
 
+#define DML_PCLMULQDQ (1 << 1)
+
+#define DML_BMI1 (1 << 3)
+#define DML_AVX2 (1 << 5)
+
+#define DML_AVX2_MASK (DML_BMI1 | DML_AVX2)
+
 #define DML_AVX512F  (1 << 16)
 #define DML_AVX512DQ (1 << 17)
 #define DML_AVX512CD (1 << 28)
@@ -25,6 +33,8 @@ typedef unsigned dml_register_t;
 
 #define DML_AVX512_MASK (DML_AVX512F | DML_AVX512DQ | DML_AVX512CD | DML_AVX512BW | DML_AVX512VL)
 
+#define DML_VPCLMULQDQ (1 << 10)
+
 #define DML_CLFLUSHOPT (1 << 23)
 #define DML_CLWB       (1 << 24)
 #define DML_WAITPKG    (1 << 5)
@@ -16,18 +16,38 @@ extern "C" {
 
 void dml_ref_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx2_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
+
 void dml_avx512_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx2_mem_move_nt(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
+
+void dml_avx512_mem_move_nt(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
+
+void dml_erms_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
+
 void dml_ref_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx2_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
+
 void dml_avx512_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx2_fill_nt_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
+
+void dml_avx512_fill_nt_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
+
+void dml_erms_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
+
 uint32_t dml_ref_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result);
 
+uint32_t dml_avx2_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result);
+
 uint32_t dml_avx512_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result);
 
 uint32_t dml_ref_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result);
 
+uint32_t dml_avx2_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result);
+
 uint32_t dml_avx512_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result);
 
 uint32_t dml_ref_create_delta(const uint8_t *src1,
@@ -37,18 +57,60 @@ uint32_t dml_ref_create_delta(const uint8_t *src1,
                               uint32_t       max_delta_record_size,
                               uint8_t       *result);
 
+uint32_t dml_avx2_create_delta(const uint8_t *src1,
+                               const uint8_t *src2,
+                               uint32_t       transfer_size,
+                               uint8_t       *delta_record,
+                               uint32_t       max_delta_record_size,
+                               uint8_t       *result);
+
+uint32_t dml_avx512_create_delta(const uint8_t *src1,
+                                 const uint8_t *src2,
+                                 uint32_t       transfer_size,
+                                 uint8_t       *delta_record,
+                                 uint32_t       max_delta_record_size,
+                                 uint8_t       *result);
+
 void dml_ref_apply_delta(const uint8_t *delta_record, uint8_t *dst, uint32_t delta_record_size);
 
+void dml_avx512_apply_delta(const uint8_t *delta_record, uint8_t *dst, uint32_t delta_record_size);
+
 void dml_ref_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size);
 
+void dml_avx2_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size);
+
 uint32_t dml_ref_crc_32u(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
+uint32_t dml_avx2_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
 uint32_t dml_avx512_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
+uint32_t dml_avx512_vpclmul_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
 uint32_t dml_ref_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
+uint32_t dml_avx2_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
 uint32_t dml_avx512_crc_reflected_u32(const uint8_t* src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
+uint32_t dml_avx512_vpclmul_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_ref_crc_combine_u32(uint32_t first_crc, uint32_t second_crc, uint64_t second_size, uint32_t polynomial);
+
+uint32_t dml_ref_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_avx2_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_ref_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_avx2_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint16_t dml_ref_crc16_t10dif(const uint8_t *src, uint32_t transfer_size, uint16_t crc_value);
+
+uint16_t dml_avx2_crc16_t10dif(const uint8_t *src, uint32_t transfer_size, uint16_t crc_value);
+
+uint16_t dml_avx512_crc16_t10dif(const uint8_t *src, uint32_t transfer_size, uint16_t crc_value);
+
 void dml_clflushopt(uint8_t *dst, uint32_t transfer_size);
 
 void dml_clflush(uint8_t *dst, uint32_t transfer_size);
@@ -57,10 +119,20 @@ void dml_clwb(uint8_t *dst, uint32_t transfer_size);
 
 void dml_clwb_unsupported(uint8_t *dst, uint32_t transfer_size);
 
+void dml_clflushopt_unfenced(uint8_t *dst, uint32_t transfer_size);
+
+void dml_clflush_unfenced(uint8_t *dst, uint32_t transfer_size);
+
+void dml_clwb_unfenced(uint8_t *dst, uint32_t transfer_size);
+
 void dml_wait_busy_poll(const volatile uint8_t* pointer);
 
 void dml_wait_umwait(const volatile uint8_t* pointer);
 
+void dml_umwait(const volatile uint8_t *pointer, uint32_t state, uint32_t cycles);
+
+void dml_umwait_unsupported(const volatile uint8_t *pointer, uint32_t state, uint32_t cycles);
+
 #ifdef __cplusplus
 }
 #endif
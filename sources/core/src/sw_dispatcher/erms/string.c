@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <stddef.h>
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#endif
+
+static inline void own_movsb(const uint8_t *src, uint8_t *dst, size_t count)
+{
+#if defined(_MSC_BUILD)
+    __movsb(dst, src, count);
+#else
+    __asm__ volatile("rep movsb" : "+D"(dst), "+S"(src), "+c"(count) : : "memory");
+#endif
+}
+
+static inline void own_stosq(uint64_t pattern, uint8_t *dst, size_t count)
+{
+#if defined(_MSC_BUILD)
+    __stosq((unsigned __int64 *)dst, pattern, count);
+#else
+    __asm__ volatile("rep stosq" : "+D"(dst), "+c"(count) : "a"(pattern) : "memory");
+#endif
+}
+
+void dml_erms_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    /*
+     * src:     |-------|
+     * dst: |-------|
+     *
+     * OR no overlapping
+     *
+     * Forward string copy is applicable, the caller uses another kernel for the backward case
+     */
+    own_movsb(src, dst, transfer_size);
+}
+
+void dml_erms_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint8_t *const pattern_bytes = (const uint8_t *)&pattern;
+    const uint32_t       body_size     = transfer_size & ~(uint32_t)(sizeof(pattern) - 1u);
+
+    own_stosq(pattern, dst, body_size / sizeof(pattern));
+
+    for (uint32_t index = body_size; index < transfer_size; ++index)
+    {
+        dst[index] = pattern_bytes[index % sizeof(pattern)];
+    }
+}
@@ -6,72 +6,612 @@
 
 #include "optimization_dispatcher.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <tuple>
+#include <vector>
 
 #include "dml_cpuid.h"
 #include "dml_kernels.h"
 
 namespace dml::core::dispatch
 {
-    static auto gs_mem_move          = dml_ref_mem_move;
-    static auto gs_fill_u64          = dml_ref_fill_u64;
-    static auto gs_compare           = dml_ref_compare;
-    static auto gs_compare_pattern   = dml_ref_compare_pattern;
-    static auto gs_create_delta      = dml_ref_create_delta;
-    static auto gs_apply_delta       = dml_ref_apply_delta;
-    static auto gs_dualcast          = dml_ref_dualcast;
-    static auto gs_crc_u32           = dml_ref_crc_32u;
-    static auto gs_crc_reflected_u32 = dml_ref_crc_reflected_u32;
-    static auto gs_cache_flush       = dml_clflush;
-    static auto gs_cache_write_back  = dml_clwb_unsupported;
-    static auto gs_wait_busy_poll    = dml_wait_busy_poll;
-    static auto gs_wait_umwait       = dml_wait_busy_poll;
+    /**
+     * @brief Selected implementation of a kernel, keeps the name for the selection report
+     *
+     * Kernels are called through the pointer. Load time binding (IFUNC) would still call them through the PLT and
+     * couldn't follow DML_SW_ISA or @ref set_isa, so the pointer stays.
+     */
+    template <typename function_t>
+    struct kernel
+    {
+        template <typename... arguments_t>
+        auto operator()(arguments_t... arguments) const noexcept
+        {
+            return function(arguments...);
+        }
+
+        function_t* function;
+        const char* implementation;
+    };
+
+    template <typename function_t>
+    static constexpr kernel<function_t> make_kernel(function_t* function, const char* implementation) noexcept
+    {
+        return { function, implementation };
+    }
+
+#define DML_KERNEL(function) make_kernel(function, #function)
+
+    static void initialize() noexcept;
+
+    /**
+     * @brief Stub that every kernel is bound to before selection, selects all kernels and forwards the call
+     *
+     * Selection, including loading or calibration of the copy tuning, is done on the first call of any kernel, so
+     * programs that don't use the software path don't pay for it, and there is no order of static initialization to
+     * depend on.
+     */
+    template <typename function_t>
+    struct resolver;
+
+    template <typename result_t, typename... arguments_t>
+    struct resolver<result_t(arguments_t...)>
+    {
+        template <kernel<result_t(arguments_t...)>& selected>
+        static result_t resolve(arguments_t... arguments) noexcept
+        {
+            initialize();
+
+            return selected.function(arguments...);
+        }
+    };
+
+#define DML_KERNEL_SLOT(name, prototype)      \
+    static kernel<decltype(prototype)> name = \
+        make_kernel<decltype(prototype)>(&resolver<decltype(prototype)>::resolve<name>, "unresolved")
+
+    DML_KERNEL_SLOT(gs_mem_move, dml_ref_mem_move);
+    DML_KERNEL_SLOT(gs_fill_u64, dml_ref_fill_u64);
+    DML_KERNEL_SLOT(gs_mem_move_nt, dml_ref_mem_move);
+    DML_KERNEL_SLOT(gs_fill_nt_u64, dml_ref_fill_u64);
+    DML_KERNEL_SLOT(gs_compare, dml_ref_compare);
+    DML_KERNEL_SLOT(gs_compare_pattern, dml_ref_compare_pattern);
+    DML_KERNEL_SLOT(gs_create_delta, dml_ref_create_delta);
+    DML_KERNEL_SLOT(gs_apply_delta, dml_ref_apply_delta);
+    DML_KERNEL_SLOT(gs_dualcast, dml_ref_dualcast);
+    DML_KERNEL_SLOT(gs_crc_u32, dml_ref_crc_32u);
+    DML_KERNEL_SLOT(gs_crc_reflected_u32, dml_ref_crc_reflected_u32);
+    DML_KERNEL_SLOT(gs_copy_crc_u32, dml_ref_copy_crc_u32);
+    DML_KERNEL_SLOT(gs_copy_crc_reflected_u32, dml_ref_copy_crc_reflected_u32);
+    DML_KERNEL_SLOT(gs_crc16_t10dif, dml_ref_crc16_t10dif);
+    DML_KERNEL_SLOT(gs_cache_flush, dml_clflush);
+    DML_KERNEL_SLOT(gs_cache_write_back, dml_clwb_unsupported);
+    DML_KERNEL_SLOT(gs_cache_flush_unfenced, dml_clflush_unfenced);
+    DML_KERNEL_SLOT(gs_cache_write_back_unfenced, dml_clwb_unsupported);
+    DML_KERNEL_SLOT(gs_wait_busy_poll, dml_wait_busy_poll);
+    DML_KERNEL_SLOT(gs_wait_umwait, dml_wait_busy_poll);
+    DML_KERNEL_SLOT(gs_umwait, dml_umwait_unsupported);
+
+    static auto gs_isa = isa::ref;
+
+    static auto gs_copy_tuning = copy_tuning {};
+
+    /**
+     * @brief Transfer size starting from which streaming stores are used if the caller doesn't need the data cached
+     */
+    static constexpr uint32_t gs_non_temporal_threshold = 256u * 1024u;
+
+    static constexpr const char* gs_copy_strategy_names[] = { "vector", "string", "non_temporal" };
+
+    static bool is_supported(isa tier) noexcept
+    {
+        auto features  = dml_core_cpuid(DML_CPUID_FEATURES);
+        auto registers = dml_core_cpuid(DML_CPUID_EXTENSIONS);
+
+        switch (tier)
+        {
+            case isa::avx2:
+                return (registers.ebx & DML_AVX2_MASK) == DML_AVX2_MASK && (features.ecx & DML_PCLMULQDQ) == DML_PCLMULQDQ;
+            case isa::avx512:
+                return (registers.ebx & DML_AVX512_MASK) == DML_AVX512_MASK;
+            default:
+                return true;
+        }
+    }
+
+    /**
+     * @brief Selects kernels of the supported tiers up to the given one
+     */
+    static void select(isa tier) noexcept
+    {
+        auto registers = dml_core_cpuid(DML_CPUID_EXTENSIONS);
+
+        gs_mem_move               = DML_KERNEL(dml_ref_mem_move);
+        gs_fill_u64               = DML_KERNEL(dml_ref_fill_u64);
+        gs_mem_move_nt            = DML_KERNEL(dml_ref_mem_move);
+        gs_fill_nt_u64            = DML_KERNEL(dml_ref_fill_u64);
+        gs_compare                = DML_KERNEL(dml_ref_compare);
+        gs_compare_pattern        = DML_KERNEL(dml_ref_compare_pattern);
+        gs_create_delta           = DML_KERNEL(dml_ref_create_delta);
+        gs_apply_delta            = DML_KERNEL(dml_ref_apply_delta);
+        gs_dualcast               = DML_KERNEL(dml_ref_dualcast);
+        gs_crc_u32                = DML_KERNEL(dml_ref_crc_32u);
+        gs_crc_reflected_u32      = DML_KERNEL(dml_ref_crc_reflected_u32);
+        gs_copy_crc_u32           = DML_KERNEL(dml_ref_copy_crc_u32);
+        gs_copy_crc_reflected_u32 = DML_KERNEL(dml_ref_copy_crc_reflected_u32);
+        gs_crc16_t10dif           = DML_KERNEL(dml_ref_crc16_t10dif);
+
+        gs_isa = isa::ref;
+
+        // Tiers are applied from the lowest one, so kernels missing in a higher tier stay from the lower one
+        if (tier >= isa::avx2 && is_supported(isa::avx2))
+        {
+            gs_mem_move          = DML_KERNEL(dml_avx2_mem_move);
+            gs_fill_u64          = DML_KERNEL(dml_avx2_fill_u64);
+            gs_mem_move_nt       = DML_KERNEL(dml_avx2_mem_move_nt);
+            gs_fill_nt_u64       = DML_KERNEL(dml_avx2_fill_nt_u64);
+            gs_compare           = DML_KERNEL(dml_avx2_compare);
+            gs_compare_pattern   = DML_KERNEL(dml_avx2_compare_pattern);
+            gs_create_delta      = DML_KERNEL(dml_avx2_create_delta);
+            gs_dualcast          = DML_KERNEL(dml_avx2_dualcast);
+            gs_crc_u32           = DML_KERNEL(dml_avx2_crc_u32);
+            gs_crc_reflected_u32 = DML_KERNEL(dml_avx2_crc_reflected_u32);
+
+            gs_copy_crc_u32           = DML_KERNEL(dml_avx2_copy_crc_u32);
+            gs_copy_crc_reflected_u32 = DML_KERNEL(dml_avx2_copy_crc_reflected_u32);
+
+            gs_crc16_t10dif = DML_KERNEL(dml_avx2_crc16_t10dif);
+
+            gs_isa = isa::avx2;
+        }
+
+        if (tier >= isa::avx512 && is_supported(isa::avx512))
+        {
+            gs_mem_move          = DML_KERNEL(dml_avx512_mem_move);
+            gs_fill_u64          = DML_KERNEL(dml_avx512_fill_u64);
+            gs_mem_move_nt       = DML_KERNEL(dml_avx512_mem_move_nt);
+            gs_fill_nt_u64       = DML_KERNEL(dml_avx512_fill_nt_u64);
+            gs_compare           = DML_KERNEL(dml_avx512_compare);
+            gs_compare_pattern   = DML_KERNEL(dml_avx512_compare_pattern);
+            gs_create_delta      = DML_KERNEL(dml_avx512_create_delta);
+            gs_apply_delta       = DML_KERNEL(dml_avx512_apply_delta);
+            gs_crc_u32           = DML_KERNEL(dml_avx512_crc_u32);
+            gs_crc_reflected_u32 = DML_KERNEL(dml_avx512_crc_reflected_u32);
+
+            if ((registers.ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ)
+            {
+                gs_crc_u32           = DML_KERNEL(dml_avx512_vpclmul_crc_u32);
+                gs_crc_reflected_u32 = DML_KERNEL(dml_avx512_vpclmul_crc_reflected_u32);
+                gs_crc16_t10dif      = DML_KERNEL(dml_avx512_crc16_t10dif);
+            }
+
+            gs_isa = isa::avx512;
+        }
+    }
+
+    static void execute_mem_move(copy_strategy strategy, const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        switch (strategy)
+        {
+            case copy_strategy::string:
+                // String copy goes forward only
+                if (dst <= src || dst >= src + transfer_size)
+                {
+                    dml_erms_mem_move(src, dst, transfer_size);
+                    return;
+                }
+                break;
+            case copy_strategy::non_temporal:
+                gs_mem_move_nt(src, dst, transfer_size);
+                return;
+            default:
+                break;
+        }
+
+        gs_mem_move(src, dst, transfer_size);
+    }
+
+    static void execute_fill(copy_strategy strategy, uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        switch (strategy)
+        {
+            case copy_strategy::string:
+                dml_erms_fill_u64(pattern, dst, transfer_size);
+                break;
+            case copy_strategy::non_temporal:
+                gs_fill_nt_u64(pattern, dst, transfer_size);
+                break;
+            default:
+                gs_fill_u64(pattern, dst, transfer_size);
+                break;
+        }
+    }
+
+    /**
+     * @brief Returns the best time of one call in nanoseconds, calls are repeated to process enough bytes for stable timing
+     */
+    template <typename function_t>
+    static double measure(function_t function, uint32_t transfer_size) noexcept
+    {
+        constexpr uint64_t round_bytes = 32u << 20u;
+        constexpr uint32_t rounds      = 3u;
+
+        const auto iterations = std::max<uint64_t>(2u, round_bytes / transfer_size);
+
+        auto best = std::chrono::steady_clock::duration::max();
+
+        for (auto round = 0u; round < rounds; ++round)
+        {
+            const auto start = std::chrono::steady_clock::now();
+
+            for (auto i = uint64_t(0u); i < iterations; ++i)
+            {
+                function();
+            }
+
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+        }
+
+        return std::chrono::duration<double, std::nano>(best).count() / static_cast<double>(iterations);
+    }
+
+    /**
+     * @brief Returns the fastest strategy, the vector one is kept unless another one is noticeably faster
+     */
+    template <typename function_t>
+    static copy_strategy select_strategy(function_t function, uint32_t transfer_size) noexcept
+    {
+        constexpr double margin = 0.95;
+
+        auto strategy = copy_strategy::vector;
+        auto best     = measure(
+            [&]
+            {
+                function(copy_strategy::vector);
+            },
+            transfer_size);
+
+        for (auto candidate : { copy_strategy::string, copy_strategy::non_temporal })
+        {
+            const auto time = measure(
+                [&]
+                {
+                    function(candidate);
+                },
+                transfer_size);
+
+            if (time < best * margin)
+            {
+                strategy = candidate;
+                best     = time;
+            }
+        }
+
+        return strategy;
+    }
 
     class dispatcher
     {
     public:
         dispatcher() noexcept
         {
-
             auto registers = dml_core_cpuid(DML_CPUID_EXTENSIONS);
 
-            if ((registers.ebx & DML_AVX512_MASK) == DML_AVX512_MASK)
+            select(get_max_isa());
+
+            // Override is used to compare tiers on the same CPU, unknown values are ignored
+            if (const char* name = std::getenv("DML_SW_ISA"); name != nullptr)
             {
-                gs_mem_move        = dml_avx512_mem_move;
-                gs_fill_u64        = dml_avx512_fill_u64;
-                gs_compare         = dml_avx512_compare;
-                gs_compare_pattern = dml_avx512_compare_pattern;
-                gs_crc_u32         = dml_avx512_crc_u32;
-                gs_crc_reflected_u32 = dml_avx512_crc_reflected_u32;
+                if (std::strcmp(name, "ref") == 0)
+                {
+                    select(isa::ref);
+                }
+                else if (std::strcmp(name, "avx2") == 0)
+                {
+                    select(isa::avx2);
+                }
             }
 
+            // Tuning is either measured on every start or measured once and kept in the file
+            if (const char* tuning = std::getenv("DML_SW_COPY_TUNING"); tuning != nullptr)
+            {
+                if (std::strcmp(tuning, "calibrate") == 0)
+                {
+                    gs_copy_tuning = calibrate_copy_tuning();
+                }
+                else if (!load_copy_tuning(tuning, gs_copy_tuning))
+                {
+                    gs_copy_tuning = calibrate_copy_tuning();
+                    save_copy_tuning(tuning, gs_copy_tuning);
+                }
+            }
+
+            // Cache and wait instructions don't depend on the tier
+            gs_cache_flush               = DML_KERNEL(dml_clflush);
+            gs_cache_write_back          = DML_KERNEL(dml_clwb_unsupported);
+            gs_cache_flush_unfenced      = DML_KERNEL(dml_clflush_unfenced);
+            gs_cache_write_back_unfenced = DML_KERNEL(dml_clwb_unsupported);
+            gs_wait_busy_poll            = DML_KERNEL(dml_wait_busy_poll);
+            gs_wait_umwait               = DML_KERNEL(dml_wait_busy_poll);
+            gs_umwait                    = DML_KERNEL(dml_umwait_unsupported);
+
             if ((registers.ebx & DML_CLFLUSHOPT) == DML_CLFLUSHOPT)
             {
-                gs_cache_flush = dml_clflushopt;
+                gs_cache_flush          = DML_KERNEL(dml_clflushopt);
+                gs_cache_flush_unfenced = DML_KERNEL(dml_clflushopt_unfenced);
             }
 
             if ((registers.ebx & DML_CLWB) == DML_CLWB)
             {
-                gs_cache_write_back = dml_clwb;
+                gs_cache_write_back          = DML_KERNEL(dml_clwb);
+                gs_cache_write_back_unfenced = DML_KERNEL(dml_clwb_unfenced);
             }
 
             if ((registers.ecx & DML_WAITPKG) == DML_WAITPKG)
             {
-                gs_wait_umwait = dml_wait_umwait;
+                gs_wait_umwait = DML_KERNEL(dml_wait_umwait);
+                gs_umwait      = DML_KERNEL(dml_umwait);
             }
         }
     };
 
-    [[maybe_unused]] static auto gs_dispatcher = dispatcher();
+    static void initialize() noexcept
+    {
+        [[maybe_unused]] static const auto instance = dispatcher();
+    }
+
+    isa get_max_isa() noexcept
+    {
+        if (is_supported(isa::avx512))
+        {
+            return isa::avx512;
+        }
+
+        return is_supported(isa::avx2) ? isa::avx2 : isa::ref;
+    }
+
+    isa get_isa() noexcept
+    {
+        initialize();
+
+        return gs_isa;
+    }
+
+    bool set_isa(isa tier) noexcept
+    {
+        if (!is_supported(tier))
+        {
+            return false;
+        }
+
+        initialize();
+        select(tier);
+
+        return true;
+    }
+
+    std::array<kernel_implementation, kernels_count> get_implementations() noexcept
+    {
+        initialize();
+
+        return { { { "mem_move", gs_mem_move.implementation },
+                   { "fill", gs_fill_u64.implementation },
+                   { "mem_move_non_temporal", gs_mem_move_nt.implementation },
+                   { "fill_non_temporal", gs_fill_nt_u64.implementation },
+                   { "compare", gs_compare.implementation },
+                   { "compare_pattern", gs_compare_pattern.implementation },
+                   { "create_delta", gs_create_delta.implementation },
+                   { "apply_delta", gs_apply_delta.implementation },
+                   { "dualcast", gs_dualcast.implementation },
+                   { "crc", gs_crc_u32.implementation },
+                   { "crc_reflected", gs_crc_reflected_u32.implementation },
+                   { "copy_crc", gs_copy_crc_u32.implementation },
+                   { "copy_crc_reflected", gs_copy_crc_reflected_u32.implementation },
+                   { "crc16_t10dif", gs_crc16_t10dif.implementation },
+                   { "cache_flush", gs_cache_flush.implementation },
+                   { "cache_write_back", gs_cache_write_back.implementation },
+                   { "cache_flush_unfenced", gs_cache_flush_unfenced.implementation },
+                   { "cache_write_back_unfenced", gs_cache_write_back_unfenced.implementation },
+                   { "wait_busy_poll", gs_wait_busy_poll.implementation },
+                   { "wait_umwait", gs_wait_umwait.implementation },
+                   { "umwait", gs_umwait.implementation } } };
+    }
+
+    uint32_t get_size_class_begin(uint32_t size_class) noexcept
+    {
+        return (size_class == 0u) ? 0u : (256u << (2u * (size_class - 1u)));
+    }
+
+    uint32_t get_size_class(uint32_t transfer_size) noexcept
+    {
+        auto size_class = 0u;
+
+        while (size_class + 1u < size_classes_count && transfer_size >= get_size_class_begin(size_class + 1u))
+        {
+            ++size_class;
+        }
+
+        return size_class;
+    }
+
+    copy_tuning get_copy_tuning() noexcept
+    {
+        initialize();
+
+        return gs_copy_tuning;
+    }
+
+    void set_copy_tuning(const copy_tuning& tuning) noexcept
+    {
+        initialize();
+
+        gs_copy_tuning = tuning;
+    }
+
+    copy_tuning calibrate_copy_tuning() noexcept
+    {
+        constexpr uint32_t min_large_size = 16u << 20u;
+        constexpr uint32_t max_large_size = 64u << 20u;
+
+        // Streaming stores win once the transfer doesn't fit the cache, so the last class is measured above its size
+        const auto cache_size = static_cast<uint32_t>(std::min<size_t>(dml_core_get_cache_size(), max_large_size));
+        const auto large_size = std::clamp(2u * cache_size, min_large_size, max_large_size);
+
+        auto src = std::vector<uint8_t>(large_size, 0x5Au);
+        auto dst = std::vector<uint8_t>(large_size, 0u);
+
+        auto tuning = copy_tuning {};
+
+        for (auto size_class = 0u; size_class < size_classes_count; ++size_class)
+        {
+            // Each class is represented by the size in the middle of it
+            const auto transfer_size = (size_class == 0u)                      ? 128u
+                                       : (size_class + 1u == size_classes_count) ? large_size
+                                                                                 : 2u * get_size_class_begin(size_class);
+
+            tuning.mem_move[size_class] = select_strategy(
+                [&](copy_strategy strategy)
+                {
+                    execute_mem_move(strategy, src.data(), dst.data(), transfer_size);
+                },
+                transfer_size);
+
+            tuning.fill[size_class] = select_strategy(
+                [&](copy_strategy strategy)
+                {
+                    execute_fill(strategy, 0x0123456789ABCDEFu, dst.data(), transfer_size);
+                },
+                transfer_size);
+        }
+
+        return tuning;
+    }
+
+    /**
+     * @brief Reads "<operation> <strategy per size class>" line, returns false if the line is malformed
+     */
+    static bool read_strategies(std::FILE* file, const char* operation, std::array<copy_strategy, size_classes_count>& strategies) noexcept
+    {
+        char name[16] = {};
+
+        if (std::fscanf(file, "%15s", name) != 1 || std::strcmp(name, operation) != 0)
+        {
+            return false;
+        }
+
+        for (auto& strategy : strategies)
+        {
+            if (std::fscanf(file, "%15s", name) != 1)
+            {
+                return false;
+            }
+
+            const auto begin = std::begin(gs_copy_strategy_names);
+            const auto end   = std::end(gs_copy_strategy_names);
+            const auto found = std::find_if(begin,
+                                            end,
+                                            [&name](const char* strategy_name)
+                                            {
+                                                return std::strcmp(strategy_name, name) == 0;
+                                            });
+
+            if (found == end)
+            {
+                return false;
+            }
+
+            strategy = static_cast<copy_strategy>(found - begin);
+        }
+
+        return true;
+    }
+
+    bool load_copy_tuning(const char* path, copy_tuning& tuning) noexcept
+    {
+        auto file = std::fopen(path, "r");
+
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        auto loaded = copy_tuning {};
+        auto result = read_strategies(file, "mem_move", loaded.mem_move) && read_strategies(file, "fill", loaded.fill);
+
+        std::fclose(file);
+
+        if (result)
+        {
+            tuning = loaded;
+        }
+
+        return result;
+    }
+
+    bool save_copy_tuning(const char* path, const copy_tuning& tuning) noexcept
+    {
+        auto file = std::fopen(path, "w");
+
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        auto write = [file](const char* operation, const std::array<copy_strategy, size_classes_count>& strategies)
+        {
+            std::fprintf(file, "%s", operation);
+
+            for (auto strategy : strategies)
+            {
+                std::fprintf(file, " %s", gs_copy_strategy_names[static_cast<uint32_t>(strategy)]);
+            }
+
+            std::fprintf(file, "\n");
+        };
+
+        write("mem_move", tuning.mem_move);
+        write("fill", tuning.fill);
+
+        return std::fclose(file) == 0;
+    }
 
     void mem_move(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept
     {
-        gs_mem_move(src, dst, transfer_size);
+        // Before selection every class uses vector kernels, so the first call goes through the stub and loads the tuning
+        execute_mem_move(gs_copy_tuning.mem_move[get_size_class(transfer_size)], src, dst, transfer_size);
     }
 
     void fill(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept
     {
-        gs_fill_u64(pattern, dst, transfer_size);
+        execute_fill(gs_copy_tuning.fill[get_size_class(transfer_size)], pattern, dst, transfer_size);
+    }
+
+    void mem_move_non_temporal(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        if (transfer_size < gs_non_temporal_threshold)
+        {
+            mem_move(src, dst, transfer_size);
+        }
+        else
+        {
+            gs_mem_move_nt(src, dst, transfer_size);
+        }
+    }
+
+    void fill_non_temporal(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        if (transfer_size < gs_non_temporal_threshold)
+        {
+            fill(pattern, dst, transfer_size);
+        }
+        else
+        {
+            gs_fill_nt_u64(pattern, dst, transfer_size);
+        }
     }
 
     std::tuple<uint32_t, uint8_t> compare(const uint8_t* src1, const uint8_t* src2, uint32_t transfer_size) noexcept
@@ -122,6 +662,26 @@ namespace dml::core::dispatch
         return gs_crc_reflected_u32(src, transfer_size, crc_seed, polynomial);
     }
 
+    uint32_t crc_combine(uint32_t first_crc, uint32_t second_crc, uint64_t second_size, uint32_t polynomial) noexcept
+    {
+        return dml_ref_crc_combine_u32(first_crc, second_crc, second_size, polynomial);
+    }
+
+    uint32_t copy_crc(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial) noexcept
+    {
+        return gs_copy_crc_u32(src, dst, transfer_size, crc_seed, polynomial);
+    }
+
+    uint32_t copy_crc_reflected(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial) noexcept
+    {
+        return gs_copy_crc_reflected_u32(src, dst, transfer_size, crc_seed, polynomial);
+    }
+
+    uint16_t crc16_t10dif(const uint8_t* src, uint32_t transfer_size, uint16_t crc_seed) noexcept
+    {
+        return gs_crc16_t10dif(src, transfer_size, crc_seed);
+    }
+
     void cache_flush(uint8_t* dst, uint32_t transfer_size) noexcept
     {
         gs_cache_flush(dst, transfer_size);
@@ -132,6 +692,16 @@ namespace dml::core::dispatch
         gs_cache_write_back(dst, transfer_size);
     }
 
+    void cache_flush_unfenced(uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        gs_cache_flush_unfenced(dst, transfer_size);
+    }
+
+    void cache_write_back_unfenced(uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        gs_cache_write_back_unfenced(dst, transfer_size);
+    }
+
     void wait_busy_poll(const volatile uint8_t* pointer) noexcept
     {
         gs_wait_busy_poll(pointer);
@@ -142,4 +712,9 @@ namespace dml::core::dispatch
         gs_wait_umwait(pointer);
     }
 
+    void umwait(const volatile uint8_t* pointer, uint32_t state, uint32_t cycles) noexcept
+    {
+        gs_umwait(pointer, state, cycles);
+    }
+
 }  // namespace dml::core::dispatch
@@ -7,15 +7,126 @@
 #ifndef DML_CORE_OWN_KERNELS_OPTIMIZATION_DISPATCHER_HPP
 #define DML_CORE_OWN_KERNELS_OPTIMIZATION_DISPATCHER_HPP
 
+#include <array>
 #include <cstdint>
 #include <tuple>
 
 namespace dml::core::dispatch
 {
+    /**
+     * @brief Instruction set tiers of software kernels, a tier includes kernels of the lower ones
+     */
+    enum class isa : uint8_t
+    {
+        ref,
+        avx2,
+        avx512
+    };
+
+    /**
+     * @brief Name of a kernel and of its selected implementation
+     */
+    struct kernel_implementation
+    {
+        const char* kernel;
+        const char* implementation;
+    };
+
+    constexpr uint32_t kernels_count = 21u;
+
+    /**
+     * @brief Returns the highest tier supported by the CPU
+     */
+    isa get_max_isa() noexcept;
+
+    /**
+     * @brief Returns the highest tier used by the selected kernels
+     *
+     * The tier is the highest supported one, unless it is limited by DML_SW_ISA environment variable
+     * (ref, avx2 or avx512) or by @ref set_isa.
+     */
+    isa get_isa() noexcept;
+
+    /**
+     * @brief Selects kernels up to the tier, returns false and keeps the current kernels if the CPU doesn't support it
+     *
+     * Kernels are switched without synchronization, so no operations may be executed during the call.
+     */
+    bool set_isa(isa tier) noexcept;
+
+    /**
+     * @brief Returns the selected implementation for each kernel
+     */
+    std::array<kernel_implementation, kernels_count> get_implementations() noexcept;
+
+    /**
+     * @brief Ways to move or fill memory, the fastest one depends on the CPU and the transfer size
+     */
+    enum class copy_strategy : uint8_t
+    {
+        vector,       /**< Kernel of the selected tier */
+        string,       /**< String instructions, fast on CPUs with ERMS and FSRM */
+        non_temporal  /**< Streaming stores of the selected tier */
+    };
+
+    /**
+     * @brief Transfer sizes are grouped into classes of 256, 1K, 4K ... 4M bytes and larger
+     */
+    constexpr uint32_t size_classes_count = 9u;
+
+    /**
+     * @brief Strategies of Memory Move and Fill for each size class
+     */
+    struct copy_tuning
+    {
+        std::array<copy_strategy, size_classes_count> mem_move;
+        std::array<copy_strategy, size_classes_count> fill;
+    };
+
+    /**
+     * @brief Returns the smallest transfer size of the class
+     */
+    uint32_t get_size_class_begin(uint32_t size_class) noexcept;
+
+    /**
+     * @brief Returns the class the transfer size belongs to
+     */
+    uint32_t get_size_class(uint32_t transfer_size) noexcept;
+
+    /**
+     * @brief Returns the strategies used by @ref mem_move and @ref fill
+     *
+     * The vector strategy is used for all sizes, unless DML_SW_COPY_TUNING environment variable is set.
+     * The value "calibrate" measures the strategies on the first use, any other value is a path to the tuning file.
+     * The file is created with measured strategies if it can't be loaded.
+     */
+    copy_tuning get_copy_tuning() noexcept;
+
+    /**
+     * @brief Sets the strategies, no operations may be executed during the call
+     */
+    void set_copy_tuning(const copy_tuning& tuning) noexcept;
+
+    /**
+     * @brief Measures the strategies with kernels of the selected tier and returns the fastest ones
+     */
+    copy_tuning calibrate_copy_tuning() noexcept;
+
+    /**
+     * @brief Reads the tuning file, returns false and keeps the tuning if the file is missing or malformed
+     */
+    bool load_copy_tuning(const char* path, copy_tuning& tuning) noexcept;
+
+    bool save_copy_tuning(const char* path, const copy_tuning& tuning) noexcept;
+
     void mem_move(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept;
 
     void fill(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept;
 
+    void mem_move_non_temporal(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept;
+
+    void fill_non_temporal(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept;
+
     std::tuple<uint32_t, uint8_t> compare(const uint8_t* src1, const uint8_t* src2, uint32_t transfer_size) noexcept;
 
     std::tuple<uint32_t, uint8_t> compare_pattern(uint64_t pattern, const uint8_t* src, uint32_t transfer_size) noexcept;
@@ -34,13 +145,47 @@ namespace dml::core::dispatch
 
     uint32_t crc_reflected(const uint8_t* src, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial = 0x1EDC6F41u) noexcept;
 
+    /**
+     * @brief Returns CRC of two concatenated parts calculated by @ref crc or @ref crc_reflected
+     *
+     * CRC of the second part must be calculated with zero seed, the seed of the first part applies to the result.
+     */
+    uint32_t crc_combine(uint32_t first_crc, uint32_t second_crc, uint64_t second_size, uint32_t polynomial = 0x1EDC6F41u) noexcept;
+
+    uint32_t copy_crc(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial = 0x1EDC6F41u) noexcept;
+
+    uint32_t copy_crc_reflected(const uint8_t* src,
+                                uint8_t*       dst,
+                                uint32_t       transfer_size,
+                                uint32_t       crc_seed,
+                                uint32_t       polynomial = 0x1EDC6F41u) noexcept;
+
+    uint16_t crc16_t10dif(const uint8_t* src, uint32_t transfer_size, uint16_t crc_seed) noexcept;
+
     void cache_flush(uint8_t* dst, uint32_t transfer_size) noexcept;
 
     void cache_write_back(uint8_t* dst, uint32_t transfer_size) noexcept;
 
+    /**
+     * @brief Flushes cache lines like @ref cache_flush, but without fences
+     *
+     * Flushes are weakly ordered, so the caller issues a fence before reporting completion.
+     * This allows flushing many ranges with a single fence.
+     */
+    void cache_flush_unfenced(uint8_t* dst, uint32_t transfer_size) noexcept;
+
+    void cache_write_back_unfenced(uint8_t* dst, uint32_t transfer_size) noexcept;
+
     void wait_busy_poll(const volatile uint8_t* pointer) noexcept;
 
     void wait_umwait(const volatile uint8_t* pointer) noexcept;
+
+    /**
+     * @brief Waits once with UMONITOR/UMWAIT until the byte is written or the deadline in TSC cycles passes
+     *
+     * The state is UMWAIT control, 0 for C0.2 and 1 for C0.1. Pauses once if UMWAIT is not supported.
+     */
+    void umwait(const volatile uint8_t* pointer, uint32_t state, uint32_t cycles) noexcept;
 }  // namespace dml::core::dispatch
 
 #endif  //DML_CORE_OWN_KERNELS_OPTIMIZATION_DISPATCHER_HPP
@@ -0,0 +1,21 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+uint32_t dml_ref_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    dml_ref_mem_move(src, dst, transfer_size);
+
+    return dml_ref_crc_32u(src, transfer_size, crc_value, polynomial);
+}
+
+uint32_t dml_ref_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    dml_ref_mem_move(src, dst, transfer_size);
+
+    return dml_ref_crc_reflected_u32(src, transfer_size, crc_value, polynomial);
+}
@@ -53,3 +53,63 @@ uint32_t dml_ref_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, u
 
     return crc_value;
 }
+
+/**
+ * @brief Returns (first * second) mod P, the polynomial has implicit x^32 term
+ */
+static inline uint32_t multiply_mod_32u(uint32_t first, uint32_t second, uint32_t polynomial)
+{
+    uint32_t product = 0u;
+
+    for (uint32_t bit = 0x80000000u; bit; bit >>= 1u)
+    {
+        product = (product & 0x80000000u) ? ((product << 1) ^ polynomial) : (product << 1);
+        product ^= (second & bit) ? first : 0u;
+    }
+
+    return product;
+}
+
+uint32_t dml_ref_crc_combine_u32(uint32_t first_crc, uint32_t second_crc, uint64_t second_size, uint32_t polynomial)
+{
+    // First CRC is moved over the second part, which is multiplication by x^(8 * second_size) mod P
+    uint32_t shift = 0x1u;
+    uint32_t power = 0x100u;
+
+    for (; second_size; second_size >>= 1u)
+    {
+        shift = (second_size & 1u) ? multiply_mod_32u(shift, power, polynomial) : shift;
+        power = multiply_mod_32u(power, power, polynomial);
+    }
+
+    return multiply_mod_32u(first_crc, shift, polynomial) ^ second_crc;
+}
+
+static inline uint16_t calculate_crc_16u(uint16_t crc_value, uint8_t data, uint16_t polynomial)
+{
+    const size_t   byte_width     = 8;
+    const size_t   crc_bit_count  = sizeof(crc_value) * byte_width;
+    const size_t   crc_byte_shift = crc_bit_count - byte_width;
+    const uint16_t high_bit_mask  = 1 << (crc_bit_count - 1);
+
+    crc_value ^= (data << crc_byte_shift);
+
+    for (size_t bit = 0u; bit < byte_width; ++bit)
+    {
+        crc_value = (crc_value & high_bit_mask) ? ((crc_value << 1) ^ polynomial) : (crc_value << 1);
+    }
+
+    return crc_value;
+}
+
+uint16_t dml_ref_crc16_t10dif(const uint8_t *src, uint32_t transfer_size, uint16_t crc_value)
+{
+    const uint16_t polynomial = 0x8BB7u;
+
+    for (size_t byte = 0; byte < transfer_size; ++byte)
+    {
+        crc_value = calculate_crc_16u(crc_value, src[byte], polynomial);
+    }
+
+    return crc_value;
+}
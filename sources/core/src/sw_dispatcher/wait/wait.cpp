@@ -21,29 +21,54 @@ extern "C" void dml_wait_busy_poll(const volatile uint8_t * const pointer)
   }
 }
 
-extern "C" void dml_wait_umwait(const volatile uint8_t* const pointer)
+extern "C" void dml_umwait(const volatile uint8_t* const pointer, uint32_t state, uint32_t cycles)
 {
 #if defined(__linux__)
-    while (*pointer == 0)
-    {
-        // UMONITOR
-        asm volatile(".byte 0xf3, 0x48, 0x0f, 0xae, 0xf0" : : "a"(pointer));
+    // UMONITOR
+    asm volatile(".byte 0xf3, 0x48, 0x0f, 0xae, 0xf0" : : "a"(pointer));
 
-        const auto state = uint32_t(0u);
+    // The line might be written before the monitor is armed
+    if (*pointer != 0)
+    {
+        return;
+    }
 
-        const auto timeout      = __rdtsc() + 200u; // I have no idea why 200 is used.
-        const auto timeout_low  = static_cast<uint32_t>(timeout);
-        const auto timeout_high = static_cast<uint32_t>(timeout >> 32);
+    const auto timeout      = __rdtsc() + cycles;
+    const auto timeout_low  = static_cast<uint32_t>(timeout);
+    const auto timeout_high = static_cast<uint32_t>(timeout >> 32);
 
-        auto r = uint8_t(0);
+    auto r = uint8_t(0);
 
-        // UMWAIT
-        asm volatile(".byte 0xf2, 0x48, 0x0f, 0xae, 0xf1\t\n"
-                     "setc %0\t\n"
-                     : "=r"(r)
-                     : "c"(state), "a"(timeout_low), "d"(timeout_high));
-    }
+    // UMWAIT
+    asm volatile(".byte 0xf2, 0x48, 0x0f, 0xae, 0xf1\t\n"
+                 "setc %0\t\n"
+                 : "=r"(r)
+                 : "c"(state), "a"(timeout_low), "d"(timeout_high));
 #else
-    dml_wait_busy_poll(pointer);
+    static_cast<void>(pointer);
+    static_cast<void>(state);
+    static_cast<void>(cycles);
+
+    _mm_pause();
 #endif
 }
+
+extern "C" void dml_umwait_unsupported(const volatile uint8_t* const pointer, uint32_t state, uint32_t cycles)
+{
+    static_cast<void>(pointer);
+    static_cast<void>(state);
+    static_cast<void>(cycles);
+
+    _mm_pause();
+}
+
+extern "C" void dml_wait_umwait(const volatile uint8_t* const pointer)
+{
+    // Short deadline bounds the wake-up latency if the write happens right before the monitor is armed
+    constexpr auto cycles = uint32_t(200u);
+
+    while (*pointer == 0)
+    {
+        dml_umwait(pointer, 0u, cycles);
+    }
+}
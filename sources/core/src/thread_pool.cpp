@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/thread_pool.hpp>
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace dml::core
+{
+    static std::atomic<std::uint32_t> gs_default_size = 0u;
+
+    static thread_local const thread_pool *tls_pool         = nullptr;
+    static thread_local std::uint32_t      tls_worker_index = 0u;
+
+#if defined(__linux__)
+    static void pin_current_thread(std::uint32_t index) noexcept
+    {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+        {
+            return;
+        }
+
+        const auto cpu_count = static_cast<std::uint32_t>(CPU_COUNT(&allowed));
+
+        if (cpu_count == 0u)
+        {
+            return;
+        }
+
+        // Worker N is pinned to the N-th core available to the process
+        auto target = index % cpu_count;
+
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (!CPU_ISSET(cpu, &allowed))
+            {
+                continue;
+            }
+
+            if (target-- == 0u)
+            {
+                cpu_set_t pinned;
+                CPU_ZERO(&pinned);
+                CPU_SET(cpu, &pinned);
+
+                static_cast<void>(sched_setaffinity(0, sizeof(pinned), &pinned));
+                return;
+            }
+        }
+    }
+#endif
+
+    thread_pool::thread_pool(std::uint32_t threads_count) noexcept
+    {
+        if (threads_count == 0u)
+        {
+            threads_count = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        queues_ = std::make_unique<worker_queue[]>(threads_count);
+
+        workers_.reserve(threads_count);
+        for (auto index = 0u; index < threads_count; ++index)
+        {
+            workers_.emplace_back(&thread_pool::run, this, index);
+        }
+    }
+
+    thread_pool::~thread_pool() noexcept
+    {
+        {
+            std::lock_guard lock(sleep_mutex_);
+            stop_ = true;
+        }
+
+        wake_up_.notify_all();
+
+        for (auto &worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    void thread_pool::submit(task_t task) noexcept
+    {
+        const auto index = (tls_pool == this)
+                               ? tls_worker_index
+                               : next_queue_.fetch_add(1u, std::memory_order_relaxed) % size();
+
+        push(index, std::move(task));
+    }
+
+    std::uint32_t thread_pool::size() const noexcept
+    {
+        return static_cast<std::uint32_t>(workers_.size());
+    }
+
+    thread_pool &thread_pool::get_instance() noexcept
+    {
+        static thread_pool instance(gs_default_size.load());
+        return instance;
+    }
+
+    void thread_pool::set_default_size(std::uint32_t threads_count) noexcept
+    {
+        gs_default_size.store(threads_count);
+    }
+
+    void thread_pool::push(std::uint32_t index, task_t &&task) noexcept
+    {
+        {
+            std::lock_guard lock(queues_[index].mutex);
+            queues_[index].tasks.push_back(std::move(task));
+        }
+
+        pending_tasks_.fetch_add(1u);
+
+        // Workers announce themselves before checking pending_tasks_, so either
+        // a worker sees the new task or we see the sleeping worker here
+        if (sleeping_workers_.load() > 0u)
+        {
+            {
+                std::lock_guard lock(sleep_mutex_);
+            }
+
+            wake_up_.notify_one();
+        }
+    }
+
+    bool thread_pool::try_pop(std::uint32_t index, task_t &task) noexcept
+    {
+        auto &queue = queues_[index];
+
+        std::lock_guard lock(queue.mutex);
+
+        if (queue.tasks.empty())
+        {
+            return false;
+        }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+
+        return true;
+    }
+
+    bool thread_pool::try_steal(std::uint32_t index, task_t &task) noexcept
+    {
+        const auto count = size();
+
+        for (auto offset = 1u; offset < count; ++offset)
+        {
+            auto &victim = queues_[(index + offset) % count];
+
+            std::unique_lock lock(victim.mutex, std::try_to_lock);
+
+            if (!lock.owns_lock() || victim.tasks.empty())
+            {
+                continue;
+            }
+
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void thread_pool::run(std::uint32_t index) noexcept
+    {
+#if defined(__linux__)
+        pin_current_thread(index);
+#endif
+
+        tls_pool         = this;
+        tls_worker_index = index;
+
+        task_t task;
+
+        while (true)
+        {
+            if (try_pop(index, task) || try_steal(index, task))
+            {
+                pending_tasks_.fetch_sub(1u);
+
+                task();
+                task = nullptr;
+
+                continue;
+            }
+
+            std::unique_lock lock(sleep_mutex_);
+
+            sleeping_workers_.fetch_add(1u);
+            wake_up_.wait(lock,
+                          [this]
+                          {
+                              return stop_ || pending_tasks_.load() > 0u;
+                          });
+            sleeping_workers_.fetch_sub(1u);
+
+            if (stop_ && pending_tasks_.load() == 0u)
+            {
+                return;
+            }
+        }
+    }
+}  // namespace dml::core
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/wait.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <optimization_dispatcher.hpp>
+
+#include <thread>
+
+#include "immintrin.h"
+
+namespace dml::core
+{
+    static void count(dml::detail::wait_counters *counters, std::atomic<std::uint64_t> dml::detail::wait_counters::*counter) noexcept
+    {
+        if (counters != nullptr)
+        {
+            (counters->*counter).fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+
+    void wait(const volatile byte_t *pointer, const dml::detail::wait_parameters &parameters, dml::detail::wait_counters *counters) noexcept
+    {
+        using counters_t = dml::detail::wait_counters;
+
+        if (*pointer != 0u)
+        {
+            return;
+        }
+
+        count(counters, &counters_t::waits);
+
+        // Short operations finish while spinning, without the wake-up latency of UMWAIT
+        for (auto i = 0u; i < parameters.spin_iterations; ++i)
+        {
+            if (*pointer != 0u)
+            {
+                count(counters, &counters_t::spin_completions);
+                return;
+            }
+
+            _mm_pause();
+        }
+
+        for (auto i = 0u; i < parameters.umwait_iterations; ++i)
+        {
+            if (*pointer != 0u)
+            {
+                count(counters, &counters_t::umwait_completions);
+                return;
+            }
+
+            dispatch::umwait(pointer, to_underlying(parameters.state), parameters.umwait_cycles);
+        }
+
+        // Neither devices nor kernels wake up waiters, so the last stage polls between yields
+        while (*pointer == 0u)
+        {
+            std::this_thread::yield();
+        }
+
+        count(counters, &counters_t::yield_completions);
+    }
+}  // namespace dml::core
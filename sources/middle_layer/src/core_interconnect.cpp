@@ -5,14 +5,18 @@
  ******************************************************************************/
 
 #include <core/device.hpp>
+#include <core/split.hpp>
 #include <core/utils.hpp>
 #include <core/validation.hpp>
+#include <core/wait.hpp>
 #include <optimization_dispatcher.hpp>
 #include <dml/detail/common/flags.hpp>
 #include <dml/detail/ml/impl/core_interconnect.hpp>
 
 #include "partial_completion.hpp"
 #include "accumulate_records.hpp"
+#include "hybrid.hpp"
+#include "routing.hpp"
 
 namespace dml::detail::ml::impl
 {
@@ -27,6 +31,12 @@ namespace dml::detail::ml::impl
         core::any_descriptor(dsc).flags() |= completion_record_flags;
     }
 
+    void release(const descriptor& dsc) noexcept
+    {
+        static_cast<void>(core::gather(dsc, true));
+        core::hardware_device::release(dsc);
+    }
+
     [[nodiscard]] validation_status software::validate(const descriptor& dsc) noexcept
     {
         return core::validate(dsc);
@@ -58,11 +68,21 @@ namespace dml::detail::ml::impl
         }
     }
 
+    void software::wait(const descriptor& dsc, const wait_parameters& parameters, wait_counters* counters) noexcept
+    {
+        core::wait(&core::get_completion_record(dsc).bytes[0], parameters, counters);
+    }
+
     bool software::finished(const descriptor& dsc) noexcept
     {
         return core::get_completion_record(dsc).bytes[0];
     }
 
+    void software::set_parallel_threshold(std::uint32_t threshold) noexcept
+    {
+        core::software_device::set_parallel_threshold(threshold);
+    }
+
     [[nodiscard]] validation_status hardware::validate(const descriptor& dsc) noexcept
     {
         return software::validate(dsc);
@@ -75,12 +95,47 @@ namespace dml::detail::ml::impl
 
     void hardware::wait(const descriptor& dsc, bool umwait) noexcept
     {
+        static_cast<void>(core::gather(dsc, true));
         software::wait(dsc, umwait);
+        core::hardware_device::retire(dsc);
+    }
+
+    void hardware::wait(const descriptor& dsc, const wait_parameters& parameters, wait_counters* counters) noexcept
+    {
+        core::gather(dsc, parameters, counters);
+        software::wait(dsc, parameters, counters);
+        core::hardware_device::retire(dsc);
     }
 
     bool hardware::finished(const descriptor& dsc) noexcept
     {
-        return software::finished(dsc);
+        if (core::gather(dsc, false) && software::finished(dsc))
+        {
+            core::hardware_device::retire(dsc);
+            return true;
+        }
+
+        return false;
+    }
+
+    void hardware::set_queue_selection(queue_selection policy) noexcept
+    {
+        core::hardware_device::set_queue_selection(policy);
+    }
+
+    void hardware::set_striping_threshold(std::uint32_t threshold) noexcept
+    {
+        core::hardware_device::set_striping_threshold(threshold);
+    }
+
+    std::uint32_t hardware::queue_count() noexcept
+    {
+        return core::hardware_device::queue_count();
+    }
+
+    queue_counters hardware::get_queue_counters(std::uint32_t index) noexcept
+    {
+        return core::hardware_device::get_queue_counters(index);
     }
 
     [[nodiscard]] validation_status automatic::validate(const descriptor& dsc) noexcept
@@ -90,6 +145,16 @@ namespace dml::detail::ml::impl
 
     submission_status automatic::submit(const descriptor& dsc, std::uint32_t numa_id) noexcept
     {
+        if (route_to_software(dsc))
+        {
+            return core::software_device().submit(dsc);
+        }
+
+        if (submit_hybrid(dsc, numa_id))
+        {
+            return submission_status::success;
+        }
+
         auto status = core::hardware_device().submit(dsc, numa_id);
 
         // SW Fallback
@@ -101,13 +166,17 @@ namespace dml::detail::ml::impl
         return status;
     }
 
-    void automatic::wait(descriptor& dsc, bool umwait) noexcept
+    /**
+     * @brief Waits for the hardware, then finishes the operation in software if the hardware stopped on a page fault
+     */
+    template <typename waiter_t>
+    static void wait_with_continuation(descriptor& dsc, waiter_t&& waiter) noexcept
     {
         constexpr auto page_fault_status =
             to_underlying(execution_status::page_fault_during_processing);
         constexpr auto remove_rw_bit_mask = 0x7f; // READ/WRITE page fault bit is 0x80
 
-        hardware::wait(dsc, umwait);
+        waiter();
 
         auto& record = core::get_completion_record(dsc);
         auto  status = core::any_completion_record(record).status();
@@ -121,12 +190,55 @@ namespace dml::detail::ml::impl
             // Must not fail
             static_cast<void>(software::submit(dsc, 0));
 
-            software::wait(dsc, umwait);
+            waiter();
 
             accumulate_records(dsc, prev_record);
         }
     }
 
+    void automatic::wait(descriptor& dsc, bool umwait) noexcept
+    {
+        wait_with_continuation(dsc,
+                               [&dsc, umwait]
+                               {
+                                   hardware::wait(dsc, umwait);
+                               });
+    }
+
+    void automatic::wait(descriptor& dsc, const wait_parameters& parameters, wait_counters* counters) noexcept
+    {
+        wait_with_continuation(dsc,
+                               [&dsc, &parameters, counters]
+                               {
+                                   hardware::wait(dsc, parameters, counters);
+                               });
+    }
+
+    void automatic::calibrate_routing() noexcept
+    {
+        ml::calibrate_routing();
+    }
+
+    bool automatic::load_routing(const char* path) noexcept
+    {
+        return ml::load_routing(path);
+    }
+
+    bool automatic::save_routing(const char* path) noexcept
+    {
+        return ml::save_routing(path);
+    }
+
+    void automatic::reset_routing() noexcept
+    {
+        ml::reset_routing();
+    }
+
+    void automatic::set_hybrid_threshold(std::uint32_t threshold) noexcept
+    {
+        ml::set_hybrid_threshold(threshold);
+    }
+
     bool automatic::finished(descriptor& dsc) noexcept
     {
         constexpr auto page_fault_status =
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "hybrid.hpp"
+
+#include <core/completion_record_views.hpp>
+#include <core/descriptor_views.hpp>
+#include <core/operations.hpp>
+#include <core/split.hpp>
+#include <core/thread_pool.hpp>
+#include <core/utils.hpp>
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <dml/detail/ml/impl/core_interconnect.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "accumulate_records.hpp"
+#include "immintrin.h"
+#include "partial_completion.hpp"
+
+namespace dml::detail::ml
+{
+    /**
+     * @brief Part boundaries are multiples of the cache line, which also keeps 8-byte patterns in phase
+     */
+    constexpr transfer_size_t hybrid_alignment = 64u;
+
+    /**
+     * @brief The CPU part is executed in chunks of at least the minimal size
+     */
+    constexpr transfer_size_t hybrid_chunks_count   = 16u;
+    constexpr transfer_size_t hybrid_min_chunk_size = 1u << 20u;
+
+    /**
+     * @brief Shares of the hardware are kept in 1/1024 of the transfer
+     */
+    constexpr uint32_t share_scale = 1024u;
+    constexpr uint32_t min_share   = share_scale / 16u;
+    constexpr uint32_t max_share   = share_scale - min_share;
+
+    using clock = std::chrono::steady_clock;
+
+    static std::atomic<uint32_t> gs_hybrid_threshold{ 0u };
+
+    /**
+     * @brief Shares of the hardware for each operation, 0 until the first measurement
+     */
+    static std::array<std::atomic<uint32_t>, to_underlying(core::operation::crc) + 1u> gs_hardware_shares = {};
+
+    /**
+     * @brief Completes the hardware part on the CPU if the hardware stopped on a page fault or an error
+     *
+     * @return false if the hardware didn't complete the part by itself
+     */
+    static bool complete_hardware_part(descriptor &part) noexcept
+    {
+        constexpr auto remove_rw_bit_mask = 0x7f;  // READ/WRITE page fault bit is 0x80
+
+        auto      &record = core::get_completion_record(part);
+        const auto status = static_cast<execution_status>(core::any_completion_record(record).status() & remove_rw_bit_mask);
+
+        switch (status)
+        {
+            case execution_status::success:
+            case execution_status::false_predicate_success:
+                return true;
+            case execution_status::page_fault_during_processing:
+            {
+                auto prev_record = record;
+
+                update_for_continuation(part);
+                static_cast<void>(impl::software::submit(part, 0u));
+                accumulate_records(part, prev_record);
+
+                return false;
+            }
+            default:
+                static_cast<void>(impl::software::submit(part, 0u));
+
+                return false;
+        }
+    }
+
+    /**
+     * @brief Moves the share of the hardware towards the split at which both parts take the same time
+     */
+    static void adapt_share(std::atomic<uint32_t> &share,
+                            double                 hardware_size,
+                            double                 hardware_time,
+                            double                 software_size,
+                            double                 software_time) noexcept
+    {
+        const auto hardware_rate = hardware_size / std::max(hardware_time, 1.0);
+        const auto software_rate = software_size / std::max(software_time, 1.0);
+        const auto balanced      = share_scale * hardware_rate / (hardware_rate + software_rate);
+
+        // Single measurements are noisy, so the share moves a quarter of the way
+        const auto current = share.load(std::memory_order_relaxed);
+        const auto updated = (3.0 * current + balanced) / 4.0;
+
+        share.store(std::clamp(static_cast<uint32_t>(updated), min_share, max_share), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief CPU part of the transfer, shared with the task of the thread pool that may start after the operation is done
+     */
+    struct software_part
+    {
+        descriptor               dsc;
+        completion_record        record;
+        const completion_record *hardware_record;
+        clock::time_point        start;
+        clock::duration          hardware_time = clock::duration::zero(); /**< Zero if the CPU part finished first */
+        clock::duration          software_time = clock::duration::zero();
+        bool                     is_whole      = true; /**< The CPU part went to the end */
+        std::atomic<bool>        started{ false };
+        std::atomic<bool>        done{ false };
+    };
+
+    /**
+     * @brief Executes the CPU part in chunks, CRC of each chunk continues the previous one
+     *
+     * The hardware is checked after each chunk, so its time is known for any split.
+     */
+    static void run(software_part &part) noexcept
+    {
+        auto       view          = core::any_descriptor(part.dsc);
+        const auto operation     = static_cast<core::operation>(view.operation());
+        const auto software_size = view.transfer_size();
+        const auto chunk_size    = std::max(hybrid_min_chunk_size,
+                                         (software_size / hybrid_chunks_count + hybrid_alignment - 1u) & ~(hybrid_alignment - 1u));
+
+        const volatile auto *hardware_status = &part.hardware_record->bytes[0];
+
+        auto chunk_record = completion_record();
+        auto crc_value    = (operation == core::operation::crc) ? core::make_view<core::operation::crc>(part.dsc).crc_seed() : 0u;
+
+        for (auto offset = transfer_size_t(0u); offset < software_size; offset += chunk_size)
+        {
+            auto chunk = core::make_part(part.dsc, offset, std::min(chunk_size, software_size - offset));
+
+            impl::rebind(chunk, chunk_record);
+
+            if (operation == core::operation::crc)
+            {
+                core::make_view<core::operation::crc>(chunk).crc_seed() = crc_value;
+            }
+
+            static_cast<void>(impl::software::submit(chunk, 0u));
+
+            auto chunk_view = core::any_completion_record(chunk_record);
+
+            if (chunk_view.status() != to_underlying(execution_status::success) || chunk_view.result() != 0u)
+            {
+                // The first difference or error in the CPU part decides its result
+                part.record    = chunk_record;
+                auto part_view = core::any_completion_record(part.record);
+                part_view.bytes_completed() += offset;
+                part.is_whole = false;
+                break;
+            }
+
+            if (operation == core::operation::crc)
+            {
+                crc_value = core::make_view<core::operation::crc>(chunk_record).crc_value();
+            }
+
+            if (part.hardware_time == clock::duration::zero() && *hardware_status != 0u)
+            {
+                part.hardware_time = clock::now() - part.start;
+
+                // A difference in the hardware part comes first, the rest of the CPU part doesn't matter
+                if (core::any_completion_record(*part.hardware_record).result() != 0u)
+                {
+                    part.is_whole = false;
+                    break;
+                }
+            }
+        }
+
+        part.software_time = clock::now() - part.start;
+
+        if (part.is_whole)
+        {
+            core::any_completion_record(part.record).status() = to_underlying(execution_status::success);
+
+            if (operation == core::operation::crc)
+            {
+                core::make_view<core::operation::crc>(part.record).crc_value() = crc_value;
+            }
+        }
+
+        part.done.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Runs the CPU part unless another thread has already started it
+     */
+    static void try_run(software_part &part) noexcept
+    {
+        if (!part.started.exchange(true, std::memory_order_acq_rel))
+        {
+            run(part);
+        }
+    }
+
+    /**
+     * @brief The hardware takes the head of the transfer, a worker of the thread pool takes the tail
+     */
+    class hybrid final : public core::split_operation
+    {
+    public:
+        [[nodiscard]] bool wait(bool blocking) noexcept override;
+
+        void wait(const wait_parameters &parameters, wait_counters *counters) noexcept override;
+
+        void merge(const descriptor &dsc) noexcept override;
+
+        template <typename waiter_t>
+        [[nodiscard]] bool wait_parts(bool blocking, waiter_t &&wait_hardware) noexcept;
+
+        descriptor                     hardware_part;
+        completion_record              hardware_record;
+        clock::duration                hardware_time       = clock::duration::zero();
+        bool                           is_hardware_done    = false;
+        bool                           is_hardware_pending = false; /**< A check found the hardware part running */
+        std::shared_ptr<software_part> software;
+        std::atomic<uint32_t>         *share = nullptr;
+    };
+
+    /**
+     * @brief Waits for both parts, the hardware one is waited for with the waiter
+     */
+    template <typename waiter_t>
+    bool hybrid::wait_parts(bool blocking, waiter_t &&wait_hardware) noexcept
+    {
+        // The pool may not have got to the CPU part yet, the waiting thread does it then
+        if (blocking)
+        {
+            try_run(*software);
+        }
+
+        if (!is_hardware_done)
+        {
+            if (!impl::hardware::finished(hardware_part))
+            {
+                is_hardware_pending = true;
+
+                if (!blocking)
+                {
+                    return false;
+                }
+
+                wait_hardware();
+            }
+
+            is_hardware_done = true;
+            hardware_time    = clock::now() - software->start;
+        }
+
+        if (!software->done.load(std::memory_order_acquire))
+        {
+            if (!blocking)
+            {
+                return false;
+            }
+
+            while (!software->done.load(std::memory_order_acquire))
+            {
+                _mm_pause();
+            }
+        }
+
+        return true;
+    }
+
+    bool hybrid::wait(bool blocking) noexcept
+    {
+        return wait_parts(blocking,
+                          [this]
+                          {
+                              impl::hardware::wait(hardware_part, false);
+                          });
+    }
+
+    void hybrid::wait(const wait_parameters &parameters, wait_counters *counters) noexcept
+    {
+        static_cast<void>(wait_parts(true,
+                                     [this, &parameters, counters]
+                                     {
+                                         impl::hardware::wait(hardware_part, parameters, counters);
+                                     }));
+    }
+
+    void hybrid::merge(const descriptor &dsc) noexcept
+    {
+        const auto hardware_size = core::any_descriptor(hardware_part).transfer_size();
+        const auto software_size = core::any_descriptor(software->dsc).transfer_size();
+
+        // The CPU part saw the hardware finish before the waiting thread did
+        if (software->hardware_time != clock::duration::zero())
+        {
+            hardware_time = software->hardware_time;
+        }
+
+        // The hardware may have finished long before a late wait, then its time isn't known
+        const auto is_measured = software->hardware_time != clock::duration::zero() || is_hardware_pending ||
+                                 hardware_time <= software->software_time + software->software_time / hybrid_chunks_count;
+
+        if (complete_hardware_part(hardware_part) && software->is_whole && is_measured)
+        {
+            adapt_share(*share,
+                        hardware_size,
+                        static_cast<double>(hardware_time.count()),
+                        software_size,
+                        static_cast<double>(software->software_time.count()));
+        }
+
+        const core::split_part parts[] = { { &hardware_record, 0u, hardware_size },
+                                           { &software->record, hardware_size, software_size } };
+
+        core::merge_parts(dsc, parts, 2u);
+    }
+
+    bool submit_hybrid(const descriptor &dsc, std::uint32_t numa_id) noexcept
+    {
+        auto       view      = core::any_descriptor(dsc);
+        const auto size      = view.transfer_size();
+        const auto threshold = gs_hybrid_threshold.load(std::memory_order_relaxed);
+
+        // Shares are kept for operations up to CRC, Cache Flush isn't worth balancing
+        if (threshold == 0u || size < threshold || view.operation() == to_underlying(core::operation::cache_flush) ||
+            !core::is_splittable(dsc))
+        {
+            return false;
+        }
+
+        auto &share = gs_hardware_shares[view.operation()];
+
+        if (share.load(std::memory_order_relaxed) == 0u)
+        {
+            share.store(share_scale / 2u, std::memory_order_relaxed);
+        }
+
+        const auto hardware_size = static_cast<transfer_size_t>(
+            (static_cast<uint64_t>(size) * share.load(std::memory_order_relaxed) / share_scale) & ~uint64_t(hybrid_alignment - 1u));
+        const auto software_size = size - hardware_size;
+
+        if (hardware_size == 0u || software_size == 0u)
+        {
+            return false;
+        }
+
+        auto state           = std::make_unique<hybrid>();
+        state->hardware_part = core::make_part(dsc, 0u, hardware_size);
+        state->share         = &share;
+
+        impl::rebind(state->hardware_part, state->hardware_record);
+
+        auto software             = std::make_shared<software_part>();
+        software->dsc             = core::make_part(dsc, hardware_size, software_size);
+        software->hardware_record = &state->hardware_record;
+        software->start           = clock::now();
+
+        impl::rebind(software->dsc, software->record);
+
+        if (impl::hardware::submit(state->hardware_part, numa_id) != submission_status::success)
+        {
+            return false;
+        }
+
+        state->software = software;
+
+        core::get_completion_record(dsc) = completion_record();
+        core::attach(dsc, std::move(state));
+
+        core::thread_pool::get_instance().submit(
+            [software]
+            {
+                try_run(*software);
+            });
+
+        return true;
+    }
+
+    void set_hybrid_threshold(std::uint32_t threshold) noexcept
+    {
+        gs_hybrid_threshold.store(threshold, std::memory_order_relaxed);
+    }
+}  // namespace dml::detail::ml
@@ -0,0 +1,34 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_ML_OWN_HYBRID_HPP
+#define DML_ML_OWN_HYBRID_HPP
+
+#include <dml/detail/common/types.hpp>
+
+#include <cstdint>
+
+namespace dml::detail::ml
+{
+    /**
+     * @brief Submits the head of a large transfer to the hardware and the tail to the CPU at the same time
+     *
+     * Memory Move of non-overlapping buffers, Fill, Compare, Compare Pattern and CRC with the seed in the descriptor
+     * are split. The CPU part runs on the core thread pool. Results of both parts are merged into the completion
+     * record of the descriptor when it is waited for or checked, and the share of the hardware follows the throughput
+     * measured on both sides for each operation.
+     *
+     * @return false if the operation is below the threshold, can't be split or the hardware rejected its part
+     */
+    [[nodiscard]] bool submit_hybrid(const descriptor& dsc, std::uint32_t numa_id) noexcept;
+
+    /**
+     * @brief Sets the smallest transfer size that is split, zero disables splitting (default)
+     */
+    void set_hybrid_threshold(std::uint32_t threshold) noexcept;
+}  // namespace dml::detail::ml
+
+#endif  //DML_ML_OWN_HYBRID_HPP
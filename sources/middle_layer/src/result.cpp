@@ -34,4 +34,9 @@ namespace dml::detail::ml
         return core::make_view<core::operation::crc>(record).crc_value();
     }
 
+    void set_status(completion_record &record, detail::execution_status status) noexcept
+    {
+        core::any_completion_record(record).status() = static_cast<status_t>(status);
+    }
+
 }  // namespace dml::detail::ml
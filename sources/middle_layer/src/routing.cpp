@@ -0,0 +1,389 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "routing.hpp"
+
+#include <core/completion_record_views.hpp>
+#include <core/descriptor_views.hpp>
+#include <core/device.hpp>
+#include <core/operations.hpp>
+#include <optimization_dispatcher.hpp>
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/ml/impl/core_interconnect.hpp>
+#include <dml/detail/ml/impl/make_descriptor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace dml::detail::ml
+{
+    using core::dispatch::get_size_class;
+    using core::dispatch::get_size_class_begin;
+    using core::dispatch::size_classes_count;
+
+    /**
+     * @brief Expected completion times in nanoseconds for each size class, 0 if unknown
+     */
+    struct route_costs
+    {
+        std::array<std::atomic<uint32_t>, size_classes_count> software;
+        std::array<std::atomic<uint32_t>, size_classes_count> hardware;
+    };
+
+    constexpr auto operations_count = to_underlying(core::operation::cache_flush) + 1u;
+
+    using routing_model = std::array<route_costs, operations_count>;
+
+    static constexpr struct
+    {
+        const char     *name;
+        core::operation operation;
+    } gs_routed_operations[] = { { "mem_move", core::operation::mem_move },
+                                 { "fill", core::operation::fill },
+                                 { "compare", core::operation::compare },
+                                 { "compare_pattern", core::operation::compare_pattern },
+                                 { "create_delta", core::operation::create_delta },
+                                 { "apply_delta", core::operation::apply_delta },
+                                 { "dualcast", core::operation::dualcast },
+                                 { "crc", core::operation::crc },
+                                 { "copy_crc", core::operation::copy_crc },
+                                 { "dif_check", core::operation::dif_check },
+                                 { "dif_insert", core::operation::dif_insert },
+                                 { "dif_strip", core::operation::dif_strip },
+                                 { "dif_update", core::operation::dif_update },
+                                 { "cache_flush", core::operation::cache_flush } };
+
+    static routing_model gs_routing_model = {};
+
+    static void clear(routing_model &model) noexcept
+    {
+        for (auto &costs : model)
+        {
+            for (auto size_class = 0u; size_class < size_classes_count; ++size_class)
+            {
+                costs.software[size_class].store(0u, std::memory_order_relaxed);
+                costs.hardware[size_class].store(0u, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static void copy(const routing_model &from, routing_model &to) noexcept
+    {
+        for (auto operation = 0u; operation < operations_count; ++operation)
+        {
+            for (auto size_class = 0u; size_class < size_classes_count; ++size_class)
+            {
+                to[operation].software[size_class].store(from[operation].software[size_class].load(std::memory_order_relaxed),
+                                                          std::memory_order_relaxed);
+                to[operation].hardware[size_class].store(from[operation].hardware[size_class].load(std::memory_order_relaxed),
+                                                          std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static void measure_model(routing_model &model) noexcept;
+
+    static bool read_model(const char *path, routing_model &model) noexcept;
+
+    static bool write_model(const char *path, const routing_model &model) noexcept;
+
+    /**
+     * @brief Model is either measured on first use or measured once and kept in the file
+     */
+    static routing_model &get_model() noexcept
+    {
+        static const auto initialized = []
+        {
+            if (const char *routing = std::getenv("DML_AUTO_ROUTING"); routing != nullptr)
+            {
+                if (std::strcmp(routing, "calibrate") == 0)
+                {
+                    measure_model(gs_routing_model);
+                }
+                else if (!read_model(routing, gs_routing_model))
+                {
+                    measure_model(gs_routing_model);
+                    static_cast<void>(write_model(routing, gs_routing_model));
+                }
+            }
+
+            return true;
+        }();
+
+        static_cast<void>(initialized);
+
+        return gs_routing_model;
+    }
+
+    bool route_to_software(const descriptor &dsc) noexcept
+    {
+        auto       view      = core::any_descriptor(dsc);
+        const auto operation = view.operation();
+
+        if (operation >= operations_count)
+        {
+            return false;
+        }
+
+        const auto &costs      = get_model()[operation];
+        const auto  size_class = get_size_class(view.transfer_size());
+        const auto  software   = costs.software[size_class].load(std::memory_order_relaxed);
+        const auto  hardware   = costs.hardware[size_class].load(std::memory_order_relaxed);
+
+        if (software == 0u || hardware == 0u)
+        {
+            return false;
+        }
+
+        if (software <= hardware)
+        {
+            return true;
+        }
+
+        // Descriptors waiting in the queues are processed first, each is assumed to take as long as this one
+        return software <= hardware * (1.0f + core::hardware_device::load());
+    }
+
+    /**
+     * @brief Returns the best time of submitting the descriptor and waiting for it, 0 if the path didn't complete it
+     */
+    template <typename path_t>
+    static uint32_t measure(descriptor dsc) noexcept
+    {
+        constexpr auto rounds  = 5u;
+        constexpr auto numa_id = std::numeric_limits<std::uint32_t>::max();
+
+        auto record = completion_record();
+        impl::rebind(dsc, record);
+
+        auto best = std::chrono::steady_clock::duration::max();
+
+        for (auto round = 0u; round < rounds; ++round)
+        {
+            const auto start = std::chrono::steady_clock::now();
+
+            if (path_t::submit(dsc, numa_id) != submission_status::success)
+            {
+                return 0u;
+            }
+
+            path_t::wait(dsc, false);
+
+            best = std::min(best, std::chrono::steady_clock::now() - start);
+
+            if (core::any_completion_record(record).status() != to_underlying(execution_status::success))
+            {
+                return 0u;
+            }
+        }
+
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(best).count();
+
+        return static_cast<uint32_t>(std::clamp<decltype(time)>(time, 1, std::numeric_limits<uint32_t>::max()));
+    }
+
+    static void measure_model(routing_model &model) noexcept
+    {
+        constexpr auto page_size = 0x1000u;
+        constexpr auto pattern   = uint64_t(0x5A5A5A5A5A5A5A5Au);
+
+        const auto large_size = get_size_class_begin(size_classes_count - 1u);
+
+        // Destinations of Dualcast must have the same offset in a page. All bytes are equal to the pattern,
+        // so comparisons go through the whole transfer
+        auto memory = std::vector<byte_t>(3u * large_size + page_size, 0x5Au);
+        auto base   = (reinterpret_cast<uintptr_t>(memory.data()) + page_size - 1u) & ~uintptr_t(page_size - 1u);
+        auto src    = reinterpret_cast<byte_t *>(base);
+        auto dst    = src + large_size;
+        auto dst2   = dst + large_size;
+
+        clear(model);
+
+        for (auto size_class = 0u; size_class < size_classes_count; ++size_class)
+        {
+            // Each class is represented by the size in the middle of it
+            const auto size = (size_class == 0u)                      ? 128u
+                              : (size_class + 1u == size_classes_count) ? large_size
+                                                                        : 2u * get_size_class_begin(size_class);
+
+            const descriptor descriptors[] = {
+                impl::make_mem_move_descriptor(src, dst, size, mem_move_options()),
+                impl::make_fill_descriptor(pattern, dst, size, fill_options()),
+                impl::make_compare_descriptor(src, dst, size, compare_options(), compare_result::equal),
+                impl::make_compare_pattern_descriptor(pattern, src, size, compare_pattern_options(), compare_result::equal),
+                impl::make_dualcast_descriptor(src, dst, dst2, size, dualcast_options(), dualcast_specific_options()),
+                impl::make_crc_descriptor(src, size, 0u, crc_options(), crc_specific_options()),
+                impl::make_copy_crc_descriptor(src, dst, size, 0u, copy_crc_options(), copy_crc_specific_options()),
+                impl::make_cache_flush_descriptor(dst, size, cache_flush_options())
+            };
+
+            for (const auto &dsc : descriptors)
+            {
+                auto &costs = model[core::any_descriptor(dsc).operation()];
+
+                costs.software[size_class].store(measure<impl::software>(dsc), std::memory_order_relaxed);
+                costs.hardware[size_class].store(measure<impl::hardware>(dsc), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Reads "<operation> <software|hardware> <nanoseconds per size class>" line
+     *
+     * Returns true at the end of the file, false if the line is malformed.
+     */
+    static bool read_costs(std::FILE *file, routing_model &model, bool &end) noexcept
+    {
+        char operation[16] = {};
+        char path[16]      = {};
+
+        const auto count = std::fscanf(file, "%15s %15s", operation, path);
+
+        if (count == EOF)
+        {
+            end = true;
+            return true;
+        }
+
+        const auto begin = std::begin(gs_routed_operations);
+        const auto found = std::find_if(begin,
+                                        std::end(gs_routed_operations),
+                                        [&operation](const auto &entry)
+                                        {
+                                            return std::strcmp(entry.name, operation) == 0;
+                                        });
+
+        if (count != 2 || found == std::end(gs_routed_operations))
+        {
+            return false;
+        }
+
+        auto &costs = model[to_underlying(found->operation)];
+        auto *times = (std::strcmp(path, "software") == 0)   ? &costs.software
+                      : (std::strcmp(path, "hardware") == 0) ? &costs.hardware
+                                                              : nullptr;
+
+        if (times == nullptr)
+        {
+            return false;
+        }
+
+        for (auto &time : *times)
+        {
+            auto value = 0u;
+
+            if (std::fscanf(file, "%u", &value) != 1)
+            {
+                return false;
+            }
+
+            time.store(value, std::memory_order_relaxed);
+        }
+
+        return true;
+    }
+
+    static bool read_model(const char *path, routing_model &model) noexcept
+    {
+        auto file = std::fopen(path, "r");
+
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        auto loaded = routing_model();
+        auto end    = false;
+        auto result = true;
+
+        while (result && !end)
+        {
+            result = read_costs(file, loaded, end);
+        }
+
+        std::fclose(file);
+
+        if (result)
+        {
+            copy(loaded, model);
+        }
+
+        return result;
+    }
+
+    static bool write_model(const char *path, const routing_model &model) noexcept
+    {
+        auto file = std::fopen(path, "w");
+
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        auto write = [file](const char *operation, const char *path, const std::array<std::atomic<uint32_t>, size_classes_count> &times)
+        {
+            std::fprintf(file, "%s %s", operation, path);
+
+            for (const auto &time : times)
+            {
+                std::fprintf(file, " %u", time.load(std::memory_order_relaxed));
+            }
+
+            std::fprintf(file, "\n");
+        };
+
+        for (const auto &entry : gs_routed_operations)
+        {
+            const auto &costs = model[to_underlying(entry.operation)];
+
+            // Operations without costs are left out, so they stay unknown when the file is loaded
+            const auto is_known = std::any_of(costs.hardware.begin(),
+                                              costs.hardware.end(),
+                                              [](const std::atomic<uint32_t> &time)
+                                              {
+                                                  return time.load(std::memory_order_relaxed) != 0u;
+                                              });
+
+            if (is_known)
+            {
+                write(entry.name, "software", costs.software);
+                write(entry.name, "hardware", costs.hardware);
+            }
+        }
+
+        return std::fclose(file) == 0;
+    }
+
+    void calibrate_routing() noexcept
+    {
+        auto model = routing_model();
+        measure_model(model);
+
+        copy(model, get_model());
+    }
+
+    bool load_routing(const char *path) noexcept
+    {
+        return read_model(path, get_model());
+    }
+
+    bool save_routing(const char *path) noexcept
+    {
+        return write_model(path, get_model());
+    }
+
+    void reset_routing() noexcept
+    {
+        clear(get_model());
+    }
+}  // namespace dml::detail::ml
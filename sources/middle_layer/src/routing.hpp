@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_ML_OWN_ROUTING_HPP
+#define DML_ML_OWN_ROUTING_HPP
+
+#include <dml/detail/common/types.hpp>
+
+namespace dml::detail::ml
+{
+    /**
+     * @brief Returns true if the CPU is expected to complete the descriptor before the hardware
+     *
+     * Expected completion times come from the cost model of the operation and transfer size. The hardware time
+     * grows with descriptors already waiting in work queues. Without a cost for the operation and size
+     * the hardware is preferred.
+     *
+     * The model is empty unless DML_AUTO_ROUTING environment variable is set. The value "calibrate" measures
+     * both paths on first use, any other value is a path to the tuning file. The file is created with measured
+     * costs if it can't be loaded.
+     */
+    [[nodiscard]] bool route_to_software(const descriptor& dsc) noexcept;
+
+    /**
+     * @brief Measures both paths for operations with a transfer size and replaces the model
+     */
+    void calibrate_routing() noexcept;
+
+    /**
+     * @brief Reads the tuning file, returns false and keeps the model if the file is missing or malformed
+     */
+    [[nodiscard]] bool load_routing(const char* path) noexcept;
+
+    [[nodiscard]] bool save_routing(const char* path) noexcept;
+
+    /**
+     * @brief Empties the model, so the hardware is always tried first
+     */
+    void reset_routing() noexcept;
+}  // namespace dml::detail::ml
+
+#endif  //DML_ML_OWN_ROUTING_HPP
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/thread_pool.hpp>
+#include <dml/detail/ml/impl/thread_pool.hpp>
+
+namespace dml::detail::ml::impl
+{
+    thread_pool::thread_pool(std::uint32_t threads_count):
+        own_pool_(std::make_unique<core::thread_pool>(threads_count)),
+        pool_(own_pool_.get())
+    {
+    }
+
+    thread_pool::thread_pool(default_tag) noexcept: own_pool_(), pool_(&core::thread_pool::get_instance())
+    {
+    }
+
+    thread_pool::~thread_pool() noexcept = default;
+
+    void thread_pool::submit(task_t task) const noexcept
+    {
+        pool_->submit(std::move(task));
+    }
+
+    std::uint32_t thread_pool::size() const noexcept
+    {
+        return pool_->size();
+    }
+
+    thread_pool& thread_pool::get_default() noexcept
+    {
+        static thread_pool instance{ default_tag() };
+        return instance;
+    }
+
+    void thread_pool::set_default_size(std::uint32_t threads_count) noexcept
+    {
+        core::thread_pool::set_default_size(threads_count);
+    }
+}  // namespace dml::detail::ml::impl
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include <cstdint>
+#include <vector>
+
+// Software CRC kernels are compared directly, without descriptor processing overhead
+namespace
+{
+using crc_kernel_t = std::uint32_t (*)(const std::uint8_t *, std::uint32_t, std::uint32_t, std::uint32_t);
+
+constexpr std::uint32_t crc_polynomial = 0x1EDC6F41u;
+
+bool avx512_supported()
+{
+    return (dml_core_cpuid(DML_CPUID_EXTENSIONS).ebx & DML_AVX512_MASK) == DML_AVX512_MASK;
+}
+
+bool vpclmulqdq_supported()
+{
+    return avx512_supported() && (dml_core_cpuid(DML_CPUID_EXTENSIONS).ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ;
+}
+
+void crc_kernel(benchmark::State &state, crc_kernel_t kernel, bool supported)
+{
+    if (!supported)
+    {
+        state.SkipWithError("crc_kernel: kernel is not supported by the CPU");
+        return;
+    }
+
+    const auto size = static_cast<std::uint32_t>(state.range(0));
+
+    std::vector<std::uint8_t> buffer(size);
+
+    for (std::uint32_t i = 0u; i < size; ++i)
+    {
+        buffer[i] = static_cast<std::uint8_t>(i * 31u + 7u);
+    }
+
+    std::uint32_t crc = 0u;
+
+    for (auto _ : state)
+    {
+        crc = kernel(buffer.data(), size, crc, crc_polynomial);
+        benchmark::DoNotOptimize(crc);
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * size);
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(crc_kernel, avx512, dml_avx512_crc_u32, avx512_supported())->RangeMultiplier(4)->Range(256, 1 << 20);
+BENCHMARK_CAPTURE(crc_kernel, avx512_vpclmul, dml_avx512_vpclmul_crc_u32, vpclmulqdq_supported())->RangeMultiplier(4)->Range(256, 1 << 20);
+BENCHMARK_CAPTURE(crc_kernel, avx512_reflected, dml_avx512_crc_reflected_u32, avx512_supported())->RangeMultiplier(4)->Range(256, 1 << 20);
+BENCHMARK_CAPTURE(crc_kernel, avx512_vpclmul_reflected, dml_avx512_vpclmul_crc_reflected_u32, vpclmulqdq_supported())
+    ->RangeMultiplier(4)
+    ->Range(256, 1 << 20);
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <optimization_dispatcher.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Software kernels of every instruction set tier are compared on the same host
+namespace
+{
+namespace dispatch = dml::core::dispatch;
+
+/**
+ * @brief Selects the tier for the lifetime of the object and restores the previous one
+ */
+class isa_scope
+{
+public:
+    explicit isa_scope(dispatch::isa tier) noexcept: previous_(dispatch::get_isa()), supported_(dispatch::set_isa(tier))
+    {
+    }
+
+    ~isa_scope() noexcept
+    {
+        dispatch::set_isa(previous_);
+    }
+
+    [[nodiscard]] bool supported() const noexcept
+    {
+        return supported_;
+    }
+
+private:
+    dispatch::isa previous_;
+    bool          supported_;
+};
+
+std::vector<std::uint8_t> make_buffer(std::uint32_t size)
+{
+    std::vector<std::uint8_t> buffer(size);
+
+    for (std::uint32_t i = 0u; i < size; ++i)
+    {
+        buffer[i] = static_cast<std::uint8_t>(i * 31u + 7u);
+    }
+
+    return buffer;
+}
+
+const char *implementation(const char *kernel)
+{
+    for (auto entry : dispatch::get_implementations())
+    {
+        if (std::strcmp(entry.kernel, kernel) == 0)
+        {
+            return entry.implementation;
+        }
+    }
+
+    return "";
+}
+
+template <typename kernel_t>
+void tier_kernel(benchmark::State &state, dispatch::isa tier, const char *kernel_name, kernel_t kernel)
+{
+    auto scope = isa_scope(tier);
+
+    if (!scope.supported())
+    {
+        state.SkipWithError("tier_kernel: tier is not supported by the CPU");
+        return;
+    }
+
+    const auto size = static_cast<std::uint32_t>(state.range(0));
+
+    auto src = make_buffer(size);
+    auto dst = std::vector<std::uint8_t>(size);
+
+    for (auto _ : state)
+    {
+        kernel(src.data(), dst.data(), size);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * size);
+    state.SetLabel(implementation(kernel_name));
+}
+
+void mem_move(benchmark::State &state, dispatch::isa tier)
+{
+    tier_kernel(state,
+                tier,
+                "mem_move",
+                [](const std::uint8_t *src, std::uint8_t *dst, std::uint32_t size)
+                {
+                    dispatch::mem_move(src, dst, size);
+                });
+}
+
+void fill(benchmark::State &state, dispatch::isa tier)
+{
+    tier_kernel(state,
+                tier,
+                "fill",
+                [](const std::uint8_t *, std::uint8_t *dst, std::uint32_t size)
+                {
+                    dispatch::fill(0x0123456789ABCDEFu, dst, size);
+                });
+}
+
+void compare(benchmark::State &state, dispatch::isa tier)
+{
+    tier_kernel(state,
+                tier,
+                "compare",
+                [](const std::uint8_t *src, std::uint8_t *, std::uint32_t size)
+                {
+                    benchmark::DoNotOptimize(dispatch::compare(src, src, size));
+                });
+}
+
+void crc(benchmark::State &state, dispatch::isa tier)
+{
+    tier_kernel(state,
+                tier,
+                "crc_reflected",
+                [](const std::uint8_t *src, std::uint8_t *, std::uint32_t size)
+                {
+                    benchmark::DoNotOptimize(dispatch::crc_reflected(src, size, 0u));
+                });
+}
+
+/**
+ * @brief Registers the case for every tier available on the host, so results of one run can be compared
+ */
+template <typename case_t>
+bool register_tiers(const std::string &name, case_t case_function)
+{
+    constexpr std::pair<dispatch::isa, const char *> tiers[] = { { dispatch::isa::ref, "ref" },
+                                                                 { dispatch::isa::avx2, "avx2" },
+                                                                 { dispatch::isa::avx512, "avx512" } };
+
+    for (auto [tier, tier_name] : tiers)
+    {
+        if (tier > dispatch::get_max_isa())
+        {
+            break;
+        }
+
+        benchmark::RegisterBenchmark((name + "/isa:" + tier_name).c_str(), case_function, tier)->RangeMultiplier(16)->Range(4096, 4 << 20);
+    }
+
+    return true;
+}
+
+[[maybe_unused]] const bool registered = register_tiers("tier/mem_move", mem_move) && register_tiers("tier/fill", fill) &&
+                                         register_tiers("tier/compare", compare) && register_tiers("tier/crc", crc);
+}  // namespace
@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain Algorithmic tests for AVX2 kernels, which are compared with the reference kernels
+ * @details Test list:
+ *      - @ref ta_avx2_mem_move_overlapping
+ *      - @ref ta_avx2_fill_and_compare
+ *      - @ref ta_avx2_delta
+ *      - @ref ta_avx2_crc
+ *      - @ref ta_avx2_crc_alternating
+ *      - @ref ta_avx2_copy_crc
+ *      - @ref ta_avx2_crc16_t10dif
+ *      - @ref ta_avx2_non_temporal
+ *
+ * @date 10/18/2023
+ *
+ */
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include "t_common.hpp"
+#include "t_random_generator.hpp"
+#include "t_random_parameters.hpp"
+
+/** Lengths cover small, vector tail and unrolled loop paths */
+constexpr uint32_t AVX2_MAX_LENGTH = 1100u;
+
+static bool avx2_supported()
+{
+    const auto features   = dml_core_cpuid(DML_CPUID_FEATURES);
+    const auto extensions = dml_core_cpuid(DML_CPUID_EXTENSIONS);
+
+    return (extensions.ebx & DML_AVX2_MASK) == DML_AVX2_MASK && (features.ecx & DML_PCLMULQDQ) == DML_PCLMULQDQ;
+}
+
+#define SKIP_IF_NO_AVX2()                            \
+    if (!avx2_supported())                           \
+    {                                                \
+        GTEST_SKIP() << "AVX2 is not supported";     \
+    }
+
+/**
+ * @brief Tests dml_avx2_mem_move against dml_ref_mem_move with overlapping buffers in both directions
+ */
+auto ta_avx2_mem_move_overlapping() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    constexpr int32_t max_shift = 70;
+
+    std::vector<uint8_t> origin(AVX2_MAX_LENGTH + 4u * max_shift);
+    std::generate(origin.begin(), origin.end(), random_filler);
+
+    for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; length += 7u)
+    {
+        for (int32_t shift = -max_shift; shift <= max_shift; shift += 5)
+        {
+            auto reference = origin;
+            auto actual    = origin;
+
+            const auto src_offset = 2u * max_shift;
+            const auto dst_offset = src_offset + shift;
+
+            dml_ref_mem_move(reference.data() + src_offset, reference.data() + dst_offset, length);
+            dml_avx2_mem_move(actual.data() + src_offset, actual.data() + dst_offset, length);
+
+            ASSERT_EQ(reference, actual) << "length = " << length << ", shift = " << shift;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_mem_move_overlapping);
+
+/**
+ * @brief Tests fill, dualcast, compare and compare pattern kernels against the reference ones
+ */
+auto ta_avx2_fill_and_compare() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint64_t> random_pattern(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_position(test_system::get_seed());
+
+    for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; ++length)
+    {
+        const auto pattern = random_pattern.get_next();
+        const auto offset  = length % 8u;
+
+        std::vector<uint8_t> reference(AVX2_MAX_LENGTH + 16u, 0u);
+        std::vector<uint8_t> actual(AVX2_MAX_LENGTH + 16u, 0u);
+
+        dml_ref_fill_u64(pattern, reference.data() + offset, length);
+        dml_avx2_fill_u64(pattern, actual.data() + offset, length);
+
+        ASSERT_EQ(reference, actual) << "fill, length = " << length;
+
+        std::vector<uint8_t> dst1(length);
+        std::vector<uint8_t> dst2(length);
+
+        dml_avx2_dualcast(actual.data() + offset, dst1.data(), dst2.data(), length);
+
+        ASSERT_TRUE(std::equal(dst1.begin(), dst1.end(), reference.begin() + offset)) << "dualcast, length = " << length;
+        ASSERT_EQ(dst1, dst2) << "dualcast, length = " << length;
+
+        if (length > 0u)
+        {
+            actual[offset + random_position.get_next() % length] ^= 0x10u;
+        }
+
+        uint8_t reference_result = 0u;
+        uint8_t actual_result    = 0u;
+
+        auto reference_mismatch = dml_ref_compare(reference.data() + offset, actual.data() + offset, length, &reference_result);
+        auto actual_mismatch    = dml_avx2_compare(reference.data() + offset, actual.data() + offset, length, &actual_result);
+
+        ASSERT_EQ(reference_result, actual_result) << "compare, length = " << length;
+        ASSERT_EQ(reference_mismatch, actual_mismatch) << "compare, length = " << length;
+
+        reference_mismatch = dml_ref_compare_pattern(pattern, actual.data() + offset, length, &reference_result);
+        actual_mismatch    = dml_avx2_compare_pattern(pattern, actual.data() + offset, length, &actual_result);
+
+        ASSERT_EQ(reference_result, actual_result) << "compare pattern, length = " << length;
+        ASSERT_EQ(reference_mismatch, actual_mismatch) << "compare pattern, length = " << length;
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_fill_and_compare);
+
+/**
+ * @brief Tests create delta kernel (including overflow) against the reference one
+ */
+auto ta_avx2_delta() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_position(test_system::get_seed());
+
+    for (uint32_t length = 8u; length < AVX2_MAX_LENGTH; length += 8u)
+    {
+        std::vector<uint8_t> src1(length);
+        std::generate(src1.begin(), src1.end(), random_filler);
+
+        auto src2 = src1;
+
+        for (auto i = 0u; i < length / 32u + 1u; ++i)
+        {
+            src2[random_position.get_next() % length] ^= 0x01u;
+        }
+
+        const auto max_record_sizes = { 0u, 10u, 40u, length / 8u * 10u };
+
+        for (auto max_record_size : max_record_sizes)
+        {
+            std::vector<uint8_t> reference_record(max_record_size);
+            std::vector<uint8_t> actual_record(max_record_size);
+
+            uint8_t reference_result = 0u;
+            uint8_t actual_result    = 0u;
+
+            const auto reference_size =
+                dml_ref_create_delta(src1.data(), src2.data(), length, reference_record.data(), max_record_size, &reference_result);
+            const auto actual_size =
+                dml_avx2_create_delta(src1.data(), src2.data(), length, actual_record.data(), max_record_size, &actual_result);
+
+            ASSERT_EQ(reference_result, actual_result) << "length = " << length;
+            ASSERT_EQ(reference_size, actual_size) << "length = " << length;
+            ASSERT_EQ(reference_record, actual_record) << "length = " << length;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_delta);
+
+/**
+ * @brief Tests PCLMUL folding CRC kernels against the reference ones for several polynomials
+ */
+auto ta_avx2_crc() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX2_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    // Predefined constants and generated ones for IEEE 802.3, CRC-32K and CRC-32Q
+    const auto polynomials = { 0x1EDC6F41u, 0x04C11DB7u, 0x741B8CD7u, 0x814141ABu };
+
+    for (auto polynomial : polynomials)
+    {
+        for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; ++length)
+        {
+            const auto crc_seed = random_seed.get_next();
+
+            ASSERT_EQ(dml_ref_crc_32u(source.data(), length, crc_seed, polynomial),
+                      dml_avx2_crc_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length;
+            ASSERT_EQ(dml_ref_crc_reflected_u32(source.data(), length, crc_seed, polynomial),
+                      dml_avx2_crc_reflected_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_crc);
+
+/**
+ * @brief Tests CRC kernels against the reference ones for calls that alternate more polynomials than are cached
+ */
+auto ta_avx2_crc_alternating() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX2_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    // IEEE 802.3, CRC-32K, CRC-32Q, CRC-32D, CRC-32/AUTOSAR and CRC-32C in turn
+    const uint32_t polynomials[] = { 0x04C11DB7u, 0x741B8CD7u, 0x814141ABu, 0xA833982Bu, 0xF4ACFB13u, 0x1EDC6F41u };
+
+    for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; length += 1u)
+    {
+        for (auto polynomial : polynomials)
+        {
+            const auto crc_seed = random_seed.get_next();
+
+            ASSERT_EQ(dml_ref_crc_32u(source.data(), length, crc_seed, polynomial),
+                      dml_avx2_crc_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length << ", polynomial = " << polynomial;
+            ASSERT_EQ(dml_ref_crc_reflected_u32(source.data(), length, crc_seed, polynomial),
+                      dml_avx2_crc_reflected_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length << ", polynomial = " << polynomial;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_crc_alternating);
+
+/**
+ * @brief Tests fused copy with CRC kernels against the reference copy followed by CRC
+ */
+auto ta_avx2_copy_crc() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX2_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; ++length)
+    {
+        const auto crc_seed = random_seed.get_next();
+
+        // Bytes after the destination must stay untouched
+        std::vector<uint8_t> reference(AVX2_MAX_LENGTH + 16u, 0u);
+        std::vector<uint8_t> actual(AVX2_MAX_LENGTH + 16u, 0u);
+
+        ASSERT_EQ(dml_ref_copy_crc_u32(source.data(), reference.data(), length, crc_seed, 0x1EDC6F41u),
+                  dml_avx2_copy_crc_u32(source.data(), actual.data(), length, crc_seed, 0x1EDC6F41u))
+            << "length = " << length;
+        ASSERT_EQ(reference, actual) << "length = " << length;
+
+        ASSERT_EQ(dml_ref_copy_crc_reflected_u32(source.data(), reference.data(), length, crc_seed, 0x1EDC6F41u),
+                  dml_avx2_copy_crc_reflected_u32(source.data(), actual.data(), length, crc_seed, 0x1EDC6F41u))
+            << "length = " << length;
+        ASSERT_EQ(reference, actual) << "length = " << length;
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_copy_crc);
+
+/**
+ * @brief Tests PCLMUL folding CRC16 T10 DIF kernel against the reference one
+ */
+auto ta_avx2_crc16_t10dif() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint16_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX2_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; ++length)
+    {
+        const auto crc_seed = random_seed.get_next();
+
+        ASSERT_EQ(dml_ref_crc16_t10dif(source.data(), length, crc_seed), dml_avx2_crc16_t10dif(source.data(), length, crc_seed))
+            << "length = " << length;
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_crc16_t10dif);
+
+/**
+ * @brief Tests streaming store copy and fill kernels against the reference ones for all destination alignments
+ */
+auto ta_avx2_non_temporal() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint64_t> random_pattern(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX2_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    for (uint32_t length = 0u; length < AVX2_MAX_LENGTH; length += 3u)
+    {
+        const auto pattern = random_pattern.get_next();
+        const auto offset  = length % 64u;
+
+        // Bytes around the destination must stay untouched
+        std::vector<uint8_t> reference(AVX2_MAX_LENGTH + 128u, 0u);
+        std::vector<uint8_t> actual(AVX2_MAX_LENGTH + 128u, 0u);
+
+        dml_ref_mem_move(source.data(), reference.data() + offset, length);
+        dml_avx2_mem_move_nt(source.data(), actual.data() + offset, length);
+
+        ASSERT_EQ(reference, actual) << "mem move, length = " << length;
+
+        dml_ref_fill_u64(pattern, reference.data() + offset, length);
+        dml_avx2_fill_nt_u64(pattern, actual.data() + offset, length);
+
+        ASSERT_EQ(reference, actual) << "fill, length = " << length;
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_non_temporal);
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain Algorithmic tests for AVX-512 kernels, which are compared with the reference kernels
+ * @details Test list:
+ *      - @ref ta_avx512_crc
+ *      - @ref ta_avx512_crc_alternating
+ *      - @ref ta_avx512_create_delta
+ *      - @ref ta_avx512_apply_delta
+ *      - @ref ta_avx512_crc16_t10dif
+ *      - @ref ta_avx512_vpclmul_crc
+ *      - @ref ta_avx512_non_temporal
+ *
+ * @date 10/18/2023
+ *
+ */
+
+#include <cstring>
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include "t_common.hpp"
+#include "t_random_generator.hpp"
+#include "t_random_parameters.hpp"
+
+/** Lengths cover masked tail and unrolled loop paths */
+constexpr uint32_t AVX512_MAX_LENGTH = 2100u;
+
+static bool avx512_supported()
+{
+    const auto extensions = dml_core_cpuid(DML_CPUID_EXTENSIONS);
+
+    return (extensions.ebx & DML_AVX512_MASK) == DML_AVX512_MASK;
+}
+
+#define SKIP_IF_NO_AVX512()                            \
+    if (!avx512_supported())                           \
+    {                                                  \
+        GTEST_SKIP() << "AVX-512 is not supported";    \
+    }
+
+#define SKIP_IF_NO_VPCLMULQDQ()                                                         \
+    SKIP_IF_NO_AVX512();                                                                \
+    if ((dml_core_cpuid(DML_CPUID_EXTENSIONS).ecx & DML_VPCLMULQDQ) != DML_VPCLMULQDQ)  \
+    {                                                                                   \
+        GTEST_SKIP() << "VPCLMULQDQ is not supported";                                  \
+    }
+
+/**
+ * @brief Tests CRC kernels against the reference ones, long buffers of custom polynomials use generated constants
+ */
+auto ta_avx512_crc() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX512_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    const auto polynomials = { 0x1EDC6F41u, 0x04C11DB7u, 0x741B8CD7u };
+
+    for (auto polynomial : polynomials)
+    {
+        for (uint32_t length = 0u; length < AVX512_MAX_LENGTH; length += 3u)
+        {
+            const auto crc_seed = random_seed.get_next();
+
+            ASSERT_EQ(dml_ref_crc_32u(source.data(), length, crc_seed, polynomial),
+                      dml_avx512_crc_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length;
+            ASSERT_EQ(dml_ref_crc_reflected_u32(source.data(), length, crc_seed, polynomial),
+                      dml_avx512_crc_reflected_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_crc);
+
+/**
+ * @brief Tests CRC kernels against the reference ones for calls that alternate more polynomials than are cached
+ */
+auto ta_avx512_crc_alternating() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX512_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    // IEEE 802.3, CRC-32K, CRC-32Q, CRC-32D, CRC-32/AUTOSAR and CRC-32C in turn
+    const uint32_t polynomials[] = { 0x04C11DB7u, 0x741B8CD7u, 0x814141ABu, 0xA833982Bu, 0xF4ACFB13u, 0x1EDC6F41u };
+
+    for (uint32_t length = 0u; length < AVX512_MAX_LENGTH; length += 3u)
+    {
+        for (auto polynomial : polynomials)
+        {
+            const auto crc_seed = random_seed.get_next();
+
+            ASSERT_EQ(dml_ref_crc_32u(source.data(), length, crc_seed, polynomial),
+                      dml_avx512_crc_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length << ", polynomial = " << polynomial;
+            ASSERT_EQ(dml_ref_crc_reflected_u32(source.data(), length, crc_seed, polynomial),
+                      dml_avx512_crc_reflected_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length << ", polynomial = " << polynomial;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_crc_alternating);
+
+/**
+ * @brief Tests dml_avx512_create_delta against dml_ref_create_delta with sparse and dense mismatches
+ */
+auto ta_avx512_create_delta() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_position(test_system::get_seed());
+
+    for (uint32_t length = 8u; length < AVX512_MAX_LENGTH; length += 8u)
+    {
+        std::vector<uint8_t> src1(length);
+        std::generate(src1.begin(), src1.end(), random_filler);
+
+        for (auto mismatches : { length / 256u + 1u, length / 8u })
+        {
+            auto src2 = src1;
+
+            for (auto i = 0u; i < mismatches; ++i)
+            {
+                src2[random_position.get_next() % length] ^= 0x01u;
+            }
+
+            // Limits which cut a group of notes found by one compare in the middle are included
+            const auto max_record_sizes = { 0u, 10u, 35u, 90u, length / 8u * 5u, length / 8u * 10u };
+
+            for (auto max_record_size : max_record_sizes)
+            {
+                // Space after the limit must stay untouched
+                std::vector<uint8_t> reference_record(max_record_size + 80u, 0xAAu);
+                std::vector<uint8_t> actual_record(max_record_size + 80u, 0xAAu);
+
+                uint8_t reference_result = 0u;
+                uint8_t actual_result    = 0u;
+
+                const auto reference_size =
+                    dml_ref_create_delta(src1.data(), src2.data(), length, reference_record.data(), max_record_size, &reference_result);
+                const auto actual_size =
+                    dml_avx512_create_delta(src1.data(), src2.data(), length, actual_record.data(), max_record_size, &actual_result);
+
+                ASSERT_EQ(reference_result, actual_result) << "length = " << length << ", max record size = " << max_record_size;
+                ASSERT_EQ(reference_size, actual_size) << "length = " << length << ", max record size = " << max_record_size;
+                ASSERT_EQ(reference_record, actual_record) << "length = " << length << ", max record size = " << max_record_size;
+            }
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_create_delta);
+
+/**
+ * @brief Tests dml_avx512_apply_delta against dml_ref_apply_delta, including repeated offsets
+ */
+auto ta_avx512_apply_delta() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    constexpr uint32_t delta_note_size = 10u;
+    constexpr uint32_t max_notes_count = 300u;
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_offset(test_system::get_seed());
+
+    for (uint32_t notes_count = 0u; notes_count < max_notes_count; ++notes_count)
+    {
+        // Small range of offsets makes notes overwrite each other
+        for (auto offsets_range : { 4u, AVX512_MAX_LENGTH / 8u })
+        {
+            std::vector<uint8_t> delta_record(notes_count * delta_note_size);
+            std::generate(delta_record.begin(), delta_record.end(), random_filler);
+
+            for (auto i = 0u; i < notes_count; ++i)
+            {
+                const auto offset = static_cast<uint16_t>(random_offset.get_next() % offsets_range);
+
+                std::memcpy(delta_record.data() + i * delta_note_size, &offset, sizeof(offset));
+            }
+
+            std::vector<uint8_t> reference_dst(AVX512_MAX_LENGTH, 0u);
+            std::vector<uint8_t> actual_dst(AVX512_MAX_LENGTH, 0u);
+
+            const auto delta_record_size = static_cast<uint32_t>(delta_record.size());
+
+            dml_ref_apply_delta(delta_record.data(), reference_dst.data(), delta_record_size);
+            dml_avx512_apply_delta(delta_record.data(), actual_dst.data(), delta_record_size);
+
+            ASSERT_EQ(reference_dst, actual_dst) << "notes count = " << notes_count << ", offsets range = " << offsets_range;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_apply_delta);
+
+/**
+ * @brief Tests VPCLMULQDQ folding CRC16 T10 DIF kernel against the reference one on DIF block sizes and arbitrary lengths
+ */
+auto ta_avx512_crc16_t10dif() -> void
+{
+    SKIP_IF_NO_VPCLMULQDQ();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint16_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(4104u);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    std::vector<uint32_t> lengths = { 512u, 520u, 4096u, 4104u };
+
+    for (uint32_t length = 0u; length < AVX512_MAX_LENGTH; length += 3u)
+    {
+        lengths.push_back(length);
+    }
+
+    for (auto length : lengths)
+    {
+        const auto crc_seed = random_seed.get_next();
+
+        ASSERT_EQ(dml_ref_crc16_t10dif(source.data(), length, crc_seed), dml_avx512_crc16_t10dif(source.data(), length, crc_seed))
+            << "length = " << length;
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_crc16_t10dif);
+
+/**
+ * @brief Tests VPCLMULQDQ folding CRC kernels against the reference ones, other polynomials use the PCLMULQDQ kernel
+ */
+auto ta_avx512_vpclmul_crc() -> void
+{
+    SKIP_IF_NO_VPCLMULQDQ();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_seed(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX512_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    const auto polynomials = { 0x1EDC6F41u, 0x04C11DB7u };
+
+    for (auto polynomial : polynomials)
+    {
+        for (uint32_t length = 0u; length < AVX512_MAX_LENGTH; ++length)
+        {
+            const auto crc_seed = random_seed.get_next();
+
+            ASSERT_EQ(dml_ref_crc_32u(source.data(), length, crc_seed, polynomial),
+                      dml_avx512_vpclmul_crc_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length;
+            ASSERT_EQ(dml_ref_crc_reflected_u32(source.data(), length, crc_seed, polynomial),
+                      dml_avx512_vpclmul_crc_reflected_u32(source.data(), length, crc_seed, polynomial))
+                << "length = " << length;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_vpclmul_crc);
+
+/**
+ * @brief Tests streaming store copy and fill kernels against the reference ones for all destination alignments
+ */
+auto ta_avx512_non_temporal() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint64_t> random_pattern(test_system::get_seed());
+
+    std::vector<uint8_t> source(AVX512_MAX_LENGTH);
+    std::generate(source.begin(), source.end(), random_filler);
+
+    for (uint32_t length = 0u; length < AVX512_MAX_LENGTH; length += 3u)
+    {
+        const auto pattern = random_pattern.get_next();
+        const auto offset  = length % 64u;
+
+        // Bytes around the destination must stay untouched
+        std::vector<uint8_t> reference(AVX512_MAX_LENGTH + 128u, 0u);
+        std::vector<uint8_t> actual(AVX512_MAX_LENGTH + 128u, 0u);
+
+        dml_ref_mem_move(source.data(), reference.data() + offset, length);
+        dml_avx512_mem_move_nt(source.data(), actual.data() + offset, length);
+
+        ASSERT_EQ(reference, actual) << "mem move, length = " << length;
+
+        dml_ref_fill_u64(pattern, reference.data() + offset, length);
+        dml_avx512_fill_nt_u64(pattern, actual.data() + offset, length);
+
+        ASSERT_EQ(reference, actual) << "fill, length = " << length;
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_non_temporal);
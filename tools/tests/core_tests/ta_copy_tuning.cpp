@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain tests for size-bucketed strategies of Memory Move and Fill kernels
+ */
+
+#include <optimization_dispatcher.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "t_common.hpp"
+
+namespace
+{
+    namespace dispatch = dml::core::dispatch;
+
+    constexpr dispatch::copy_strategy strategies[] = { dispatch::copy_strategy::vector,
+                                                       dispatch::copy_strategy::string,
+                                                       dispatch::copy_strategy::non_temporal };
+
+    constexpr uint32_t sizes[] = { 1u, 7u, 100u, 255u, 256u, 1000u, 4099u, 70001u, 300000u, (5u << 20u) + 3u };
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    dispatch::copy_tuning make_tuning(dispatch::copy_strategy strategy)
+    {
+        auto tuning = dispatch::copy_tuning {};
+
+        tuning.mem_move.fill(strategy);
+        tuning.fill.fill(strategy);
+
+        return tuning;
+    }
+
+    std::vector<uint8_t> make_source(uint32_t size)
+    {
+        std::vector<uint8_t> src(size);
+
+        for (uint32_t i = 0u; i < size; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i * 11u + (i >> 9u));
+        }
+
+        return src;
+    }
+}  // namespace
+
+/**
+ * @brief Tests that every strategy moves and fills memory correctly, including overlapping buffers
+ */
+auto ta_copy_tuning_strategies() -> void
+{
+    const auto original = dispatch::get_copy_tuning();
+
+    for (auto strategy : strategies)
+    {
+        dispatch::set_copy_tuning(make_tuning(strategy));
+
+        for (auto size : sizes)
+        {
+            const auto src = make_source(size);
+
+            auto dst = std::vector<uint8_t>(size, 0u);
+
+            dispatch::mem_move(src.data(), dst.data(), size);
+            ASSERT_EQ(src, dst) << "size: " << size;
+
+            // Destination is after the source, only backward copy is correct
+            auto after = make_source(size + 64u);
+
+            dispatch::mem_move(after.data(), after.data() + 64u, size);
+            ASSERT_TRUE(std::equal(src.begin(), src.end(), after.begin() + 64u)) << "size: " << size;
+
+            // Destination is before the source
+            auto before = std::vector<uint8_t>(64u, 0u);
+            before.insert(before.end(), src.begin(), src.end());
+
+            dispatch::mem_move(before.data() + 64u, before.data(), size);
+            ASSERT_TRUE(std::equal(src.begin(), src.end(), before.begin())) << "size: " << size;
+
+            dispatch::fill(pattern, dst.data(), size);
+
+            for (uint32_t i = 0u; i < size; ++i)
+            {
+                ASSERT_EQ(dst[i], static_cast<uint8_t>(pattern >> ((i % 8u) * 8u))) << "size: " << size << ", index: " << i;
+            }
+        }
+    }
+
+    dispatch::set_copy_tuning(original);
+}
+
+/**
+ * @brief Tests that the tuning file keeps every strategy and malformed files are rejected
+ */
+auto ta_copy_tuning_file() -> void
+{
+    const auto path = (std::filesystem::temp_directory_path() / "dml_copy_tuning_test.txt").string();
+
+    auto tuning = dispatch::copy_tuning {};
+
+    for (auto size_class = 0u; size_class < dispatch::size_classes_count; ++size_class)
+    {
+        tuning.mem_move[size_class] = strategies[size_class % 3u];
+        tuning.fill[size_class]     = strategies[(size_class + 1u) % 3u];
+    }
+
+    ASSERT_TRUE(dispatch::save_copy_tuning(path.c_str(), tuning));
+
+    auto loaded = dispatch::copy_tuning {};
+
+    ASSERT_TRUE(dispatch::load_copy_tuning(path.c_str(), loaded));
+    ASSERT_EQ(loaded.mem_move, tuning.mem_move);
+    ASSERT_EQ(loaded.fill, tuning.fill);
+
+    auto file = std::fopen(path.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("mem_move vector string unknown\n", file);
+    std::fclose(file);
+
+    auto kept = make_tuning(dispatch::copy_strategy::string);
+
+    ASSERT_FALSE(dispatch::load_copy_tuning(path.c_str(), kept));
+    ASSERT_EQ(kept.mem_move, make_tuning(dispatch::copy_strategy::string).mem_move);
+
+    std::filesystem::remove(path);
+
+    ASSERT_FALSE(dispatch::load_copy_tuning(path.c_str(), kept));
+}
+
+/**
+ * @brief Tests size class boundaries and that calibration returns known strategies
+ */
+auto ta_copy_tuning_calibrate() -> void
+{
+    ASSERT_EQ(dispatch::get_size_class_begin(0u), 0u);
+    ASSERT_EQ(dispatch::get_size_class_begin(1u), 256u);
+    ASSERT_EQ(dispatch::get_size_class_begin(dispatch::size_classes_count - 1u), 4u << 20u);
+
+    const auto tuning = dispatch::calibrate_copy_tuning();
+
+    for (auto size_class = 0u; size_class < dispatch::size_classes_count; ++size_class)
+    {
+        ASSERT_LE(tuning.mem_move[size_class], dispatch::copy_strategy::non_temporal);
+        ASSERT_LE(tuning.fill[size_class], dispatch::copy_strategy::non_temporal);
+    }
+}
+
+CORE_TEST_REGISTER(copy_tuning, ta_copy_tuning_strategies);
+CORE_TEST_REGISTER(copy_tuning, ta_copy_tuning_file);
+CORE_TEST_REGISTER(copy_tuning, ta_copy_tuning_calibrate);
@@ -12,6 +12,7 @@
  */
 
 #include <optimization_dispatcher.hpp>
+#include <vector>
 
 #include "t_common.hpp"
 
@@ -40,4 +41,51 @@ auto ta_calculate_crc_32u_with_predefined_results() -> void
     }
 }
 
+/**
+ * @brief Tests that @ref dml::core::dispatch::crc_combine joins CRCs of two parts into CRC of the whole buffer
+ */
+auto ta_combine_crc_32u() -> void
+{
+    const std::array<uint32_t, 4u> polynomials = { 0x1EDC6F41u, 0x04C11DB7u, 0x741B8CD7u, 0x814141ABu };
+    const std::array<uint32_t, 6u> sizes       = { 0u, 1u, 7u, 64u, 1000u, 4099u };
+
+    std::vector<uint8_t> source(2u * 4099u);
+
+    for (size_t i = 0u; i < source.size(); ++i)
+    {
+        source[i] = static_cast<uint8_t>(i * 13u + (i >> 8u));
+    }
+
+    for (auto polynomial : polynomials)
+    {
+        for (auto first_size : sizes)
+        {
+            for (auto second_size : sizes)
+            {
+                const auto crc_seed = 0x1D0F5A3Cu;
+                const auto first    = source.data();
+                const auto second   = source.data() + first_size;
+
+                const auto whole = dml::core::dispatch::crc(first, first_size + second_size, crc_seed, polynomial);
+                const auto parts = dml::core::dispatch::crc_combine(dml::core::dispatch::crc(first, first_size, crc_seed, polynomial),
+                                                                    dml::core::dispatch::crc(second, second_size, 0u, polynomial),
+                                                                    second_size,
+                                                                    polynomial);
+
+                EXPECT_EQ(whole, parts);
+
+                const auto whole_reflected = dml::core::dispatch::crc_reflected(first, first_size + second_size, crc_seed, polynomial);
+                const auto parts_reflected =
+                    dml::core::dispatch::crc_combine(dml::core::dispatch::crc_reflected(first, first_size, crc_seed, polynomial),
+                                                     dml::core::dispatch::crc_reflected(second, second_size, 0u, polynomial),
+                                                     second_size,
+                                                     polynomial);
+
+                EXPECT_EQ(whole_reflected, parts_reflected);
+            }
+        }
+    }
+}
+
 CORE_TEST_REGISTER(crc_32u, ta_calculate_crc_32u_with_predefined_results);
+CORE_TEST_REGISTER(crc_32u, ta_combine_crc_32u);
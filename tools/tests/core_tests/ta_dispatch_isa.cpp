@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain tests for instruction set tier selection of software kernels
+ */
+
+#include <optimization_dispatcher.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "t_common.hpp"
+
+/**
+ * @brief Tests that every supported tier can be selected and gives the same results
+ */
+auto ta_dispatch_isa_select_supported() -> void
+{
+    namespace dispatch = dml::core::dispatch;
+
+    const auto max_isa = dispatch::get_max_isa();
+    const auto prefixes = { std::make_pair(dispatch::isa::ref, "dml_ref_"),
+                            std::make_pair(dispatch::isa::avx2, "dml_avx2_"),
+                            std::make_pair(dispatch::isa::avx512, "dml_avx512_") };
+
+    std::vector<uint8_t> src(70000u);
+
+    for (size_t i = 0u; i < src.size(); ++i)
+    {
+        src[i] = static_cast<uint8_t>(i * 13u + (i >> 8u));
+    }
+
+    ASSERT_TRUE(dispatch::set_isa(dispatch::isa::ref));
+
+    const auto reference_crc = dispatch::crc_reflected(src.data(), static_cast<uint32_t>(src.size()), 0u);
+
+    for (auto [tier, prefix] : prefixes)
+    {
+        if (tier > max_isa)
+        {
+            EXPECT_FALSE(dispatch::set_isa(tier));
+            continue;
+        }
+
+        ASSERT_TRUE(dispatch::set_isa(tier));
+        EXPECT_EQ(dispatch::get_isa(), tier);
+
+        for (auto entry : dispatch::get_implementations())
+        {
+            ASSERT_NE(entry.kernel, nullptr);
+            ASSERT_NE(entry.implementation, nullptr);
+        }
+
+        // Memory Move is implemented in every tier
+        EXPECT_EQ(std::strncmp(dispatch::get_implementations()[0].implementation, prefix, std::strlen(prefix)), 0)
+            << dispatch::get_implementations()[0].implementation;
+
+        std::vector<uint8_t> dst(src.size());
+
+        dispatch::mem_move(src.data(), dst.data(), static_cast<uint32_t>(src.size()));
+
+        EXPECT_EQ(src, dst);
+        EXPECT_EQ(dispatch::crc_reflected(src.data(), static_cast<uint32_t>(src.size()), 0u), reference_crc);
+    }
+
+    ASSERT_TRUE(dispatch::set_isa(max_isa));
+}
+
+CORE_TEST_REGISTER(dispatch_isa, ta_dispatch_isa_select_supported);
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain tests for work queues on emulated devices
+ */
+
+#if defined(__linux__)
+
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <dml/detail/ml/impl/core_interconnect.hpp>
+#include <dml/detail/ml/impl/make_descriptor.hpp>
+#include <hw_emulator.hpp>
+#include <hw_queue.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "immintrin.h"
+#include "t_common.hpp"
+
+namespace
+{
+    namespace dispatcher = dml::core::dispatcher;
+
+    constexpr uint32_t transfer_size = 4096u;
+
+    /**
+     * @brief Moves the descriptor through the queue and waits for its completion record
+     */
+    auto execute_on(const dispatcher::hw_queue &queue) -> void
+    {
+        auto src    = std::vector<uint8_t>(transfer_size);
+        auto dst    = std::vector<uint8_t>(transfer_size, 0u);
+        auto record = dml::detail::completion_record();
+
+        for (auto i = 0u; i < transfer_size; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i * 3u + 1u);
+        }
+
+        auto dsc = dml::detail::ml::impl::make_mem_move_descriptor(src.data(), dst.data(), transfer_size, {});
+        dml::detail::ml::impl::rebind(dsc, record);
+
+        ASSERT_EQ(DML_STATUS_OK, queue.enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&dsc)));
+
+        const volatile auto *status = &record.bytes[0];
+
+        while (*status == 0u)
+        {
+            _mm_pause();
+        }
+
+        ASSERT_EQ(*status, dml::detail::to_underlying(dml::detail::execution_status::success));
+        ASSERT_EQ(src, dst);
+
+        // The credit comes back only if the queue still knows the record
+        ASSERT_EQ(queue.retire(&record), queue.is_dedicated());
+    }
+}  // namespace
+
+/**
+ * @brief Tests that dedicated queues stay dedicated after the moves done while devices order their queues
+ */
+auto ta_hw_queue_move_dedicated() -> void
+{
+    auto emulator = dispatcher::hw_emulator(dispatcher::emulator_configuration::parse("queues=4,dedicated=2"));
+    auto queues   = std::vector<dispatcher::hw_queue>(emulator.get_configuration().queues);
+
+    for (auto queue_idx = 0u; queue_idx < queues.size(); ++queue_idx)
+    {
+        ASSERT_EQ(DML_STATUS_OK, queues[queue_idx].initialize_emulated_queue(emulator, 0u, queue_idx));
+    }
+
+    // Same ordering as device initialization, the heap operations move-assign queues
+    const auto by_priority = [](const dispatcher::hw_queue &a, const dispatcher::hw_queue &b)
+    {
+        return a.priority() < b.priority();
+    };
+
+    std::make_heap(queues.begin(), queues.end(), by_priority);
+    std::sort_heap(queues.begin(), queues.end(), by_priority);
+
+    auto moved = std::vector<dispatcher::hw_queue>(queues.size());
+
+    for (auto queue_idx = 0u; queue_idx < queues.size(); ++queue_idx)
+    {
+        moved[queue_idx] = std::move(queues[queue_idx]);
+    }
+
+    ASSERT_EQ(std::count_if(moved.begin(),
+                            moved.end(),
+                            [](const dispatcher::hw_queue &queue)
+                            {
+                                return queue.is_dedicated();
+                            }),
+              2);
+
+    // A dedicated queue remembers its producer thread, so submissions come from a thread that ends before the queues
+    auto producer = std::thread(
+        [&moved]
+        {
+            for (const auto &queue : moved)
+            {
+                execute_on(queue);
+            }
+        });
+
+    producer.join();
+}
+
+CORE_TEST_REGISTER(hw_queue, ta_hw_queue_move_dedicated);
+
+#endif
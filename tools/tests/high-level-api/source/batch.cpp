@@ -120,6 +120,103 @@ TYPED_TEST(dmlhl_batch, fence)
     ASSERT_EQ(src, dst);
 }
 
+TYPED_TEST(dmlhl_batch, many_operations)
+{
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length = 4096u;
+    constexpr auto seed   = 777u;
+    constexpr auto count  = 256u;
+
+    std::vector<dml::testing::mem_move> test_data;
+    test_data.reserve(count);
+
+    auto sequence = dml::sequence(count, std::allocator<dml::byte_t>());
+
+    for (auto i = 0u; i < count; ++i)
+    {
+        auto &data = test_data.emplace_back(seed + i, length);
+
+        ASSERT_EQ(sequence.add(dml::mem_move, dml::make_view(data.src), dml::make_view(data.dst)), dml::status_code::ok);
+    }
+
+    auto result = this->run(dml::batch, sequence);
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.operations_completed, count);
+
+    for (auto &data : test_data)
+    {
+        ASSERT_TRUE(data.check());
+    }
+}
+
+TYPED_TEST(dmlhl_batch, cache_flushes)
+{
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto count = 64u;
+
+    auto src = std::vector<uint8_t>(64u * 1024u, 1u);
+    auto dst = std::vector<uint8_t>(src.size(), 0u);
+
+    auto sequence = dml::sequence(count, std::allocator<dml::byte_t>());
+
+    ASSERT_EQ(sequence.add(dml::mem_move, dml::make_view(src), dml::make_view(dst)), dml::status_code::ok);
+
+    // Adjacent, overlapping, unaligned and repeated ranges, some of them after a fence
+    for (auto i = 1u; i < count; ++i)
+    {
+        const auto offset = (i * 1000u) % (dst.size() - 4096u);
+        const auto size   = 64u + (i % 7u) * 300u;
+
+        if (i == count / 2u)
+        {
+            ASSERT_EQ(sequence.add(dml::nop), dml::status_code::ok);
+            continue;
+        }
+
+        ASSERT_EQ(sequence.add(dml::cache_flush, dml::make_view(dst.data() + offset, size)), dml::status_code::ok);
+    }
+
+    auto result = this->run(dml::batch, sequence);
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.operations_completed, count);
+    ASSERT_EQ(src, dst);
+}
+
+TYPED_TEST(dmlhl_batch, failure_abandons_after_fence)
+{
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length = 16u;
+    constexpr auto seed   = 777u;
+    constexpr auto count  = 4u;
+
+    auto compare   = dml::testing::compare_equal(seed, length);
+    auto mem_move1 = dml::testing::mem_move(seed, length);
+    auto mem_move2 = dml::testing::mem_move(seed + 1u, length);
+
+    auto sequence = dml::sequence(count, std::allocator<dml::byte_t>());
+
+    // Fails with false predicate, the descriptor after it still runs, the fenced part is abandoned
+    ASSERT_EQ(sequence.add(dml::compare.expect_not_equal(), dml::make_view(compare.src1), dml::make_view(compare.src2)),
+              dml::status_code::ok);
+    ASSERT_EQ(sequence.add(dml::mem_move, dml::make_view(mem_move1.src), dml::make_view(mem_move1.dst)),
+              dml::status_code::ok);
+    ASSERT_EQ(sequence.add(dml::nop), dml::status_code::ok);
+    ASSERT_EQ(sequence.add(dml::mem_move, dml::make_view(mem_move2.src), dml::make_view(mem_move2.dst)),
+              dml::status_code::ok);
+
+    auto result = this->run(dml::batch, sequence);
+
+    ASSERT_EQ(result.status, dml::status_code::error);
+    ASSERT_EQ(result.operations_completed, 2u);
+    ASSERT_TRUE(mem_move1.check());
+    ASSERT_FALSE(mem_move2.check());
+}
+
 TYPED_TEST(dmlhl_batch, bad_length_0)
 {
     constexpr auto length = 16u;
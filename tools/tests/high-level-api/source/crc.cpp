@@ -153,6 +153,35 @@ TYPED_TEST(dmlhl_crc, all_flags) {
     }
 }
 
+TYPED_TEST(dmlhl_crc, large_buffer) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    const auto seed = test_system::get_seed();
+
+    // Buffers this large can be split between threads or devices, the result must not depend on the split
+    for (auto length: { (16u << 20u) + 13u, (5u << 20u) + 64u }) {
+        auto test_data = dml::testing::crc(seed, length);
+
+        auto result = this->run(dml::crc, dml::make_view(test_data.src), test_data.crc_seed);
+
+        ASSERT_EQ(result.status, dml::status_code::ok) << length;
+
+        const auto ref = dml::reference::calculate_crc<uint32_t, 0>(
+                test_data.src.data(), test_data.src.data() + length, test_data.crc_seed);
+
+        ASSERT_EQ(result.crc_value, ref) << length;
+
+        auto reflected_result = this->run(dml::crc.bypass_data_reflection(), dml::make_view(test_data.src), test_data.crc_seed);
+
+        ASSERT_EQ(reflected_result.status, dml::status_code::ok) << length;
+
+        const auto reflected_ref = dml::reference::calculate_crc<uint32_t, DML_FLAG_CRC_BYPASS_DATA_REFLECTION>(
+                test_data.src.data(), test_data.src.data() + length, test_data.crc_seed);
+
+        ASSERT_EQ(reflected_result.crc_value, reflected_ref) << length;
+    }
+}
+
 TYPED_TEST(dmlhl_crc, src_null) {
     constexpr auto length = 16u;
     const auto     seed   = test_system::get_seed();;
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+
+#include <dml_test_utils/crc.hpp>
+
+#include "gtest/gtest.h"
+
+#include "own/path.hpp"
+
+#include <ref_crc.hpp>
+
+#include "t_utility_functions.hpp"
+
+#include "t_random_parameters.hpp"
+
+DML_TESTING_HL_PARAMETRIZE(dmlhl_crc_stream);
+
+namespace
+{
+    // Fragments are smaller, equal and larger than the stream buffer, so all ways of processing are covered
+    constexpr uint32_t fragment_sizes[] = { 1u, 7u, 64u, 300u, 4095u, 4096u, 9000u, 3u, 70000u, 17u };
+
+    template <typename execution_path>
+    auto calculate_stream(const uint8_t *src, uint32_t length, uint32_t crc_seed, dml::crc_operation operation, dml::size_t buffer_size)
+    {
+        auto stream = dml::crc_stream<execution_path>(crc_seed, operation, buffer_size);
+
+        for (uint32_t offset = 0u, i = 0u; offset < length; ++i)
+        {
+            const auto size = std::min(fragment_sizes[i % std::size(fragment_sizes)], length - offset);
+
+            auto status = stream.update(dml::make_view(src + offset, size));
+
+            EXPECT_EQ(status, dml::status_code::ok);
+
+            offset += size;
+        }
+
+        return stream.finalize();
+    }
+}  // namespace
+
+// Stream must give the same value as a single operation on the whole buffer
+TYPED_TEST(dmlhl_crc_stream, no_flags) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length   = 200000u;
+    constexpr auto crc_seed = 0x5A5A1234u;
+
+    auto test_data = dml::testing::crc(test_system::get_seed(), length);
+
+    auto expected = this->run(dml::crc, dml::make_view(test_data.src), crc_seed);
+
+    ASSERT_EQ(expected.status, dml::status_code::ok);
+
+    for (auto buffer_size : { dml::size_t(0u), dml::size_t(64u), dml::crc_stream<dml::software>::default_buffer_size }) {
+        auto result = calculate_stream<typename TestFixture::execution_path>(test_data.src.data(), length, crc_seed, dml::crc, buffer_size);
+
+        ASSERT_EQ(result.status, dml::status_code::ok) << buffer_size;
+        ASSERT_EQ(result.crc_value, expected.crc_value) << buffer_size;
+    }
+}
+
+TYPED_TEST(dmlhl_crc_stream, bypass_reflection) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length   = 200000u;
+    constexpr auto crc_seed = 0x5A5A1234u;
+
+    auto test_data = dml::testing::crc(test_system::get_seed(), length);
+
+    auto expected = this->run(dml::crc.bypass_reflection(), dml::make_view(test_data.src), crc_seed);
+
+    ASSERT_EQ(expected.status, dml::status_code::ok);
+
+    auto result = calculate_stream<typename TestFixture::execution_path>(test_data.src.data(),
+                                                                         length,
+                                                                         crc_seed,
+                                                                         dml::crc.bypass_reflection(),
+                                                                         dml::crc_stream<dml::software>::default_buffer_size);
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.crc_value, expected.crc_value);
+}
+
+TYPED_TEST(dmlhl_crc_stream, bypass_data_reflection) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length   = 200000u;
+    constexpr auto crc_seed = 0x5A5A1234u;
+
+    auto test_data = dml::testing::crc(test_system::get_seed(), length);
+
+    auto expected = this->run(dml::crc.bypass_data_reflection(), dml::make_view(test_data.src), crc_seed);
+
+    ASSERT_EQ(expected.status, dml::status_code::ok);
+
+    auto result = calculate_stream<typename TestFixture::execution_path>(test_data.src.data(),
+                                                                         length,
+                                                                         crc_seed,
+                                                                         dml::crc.bypass_data_reflection(),
+                                                                         dml::crc_stream<dml::software>::default_buffer_size);
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.crc_value, expected.crc_value);
+}
+
+TYPED_TEST(dmlhl_crc_stream, reference) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length = 200000u;
+
+    auto test_data = dml::testing::crc(test_system::get_seed(), length);
+
+    auto result = calculate_stream<typename TestFixture::execution_path>(test_data.src.data(),
+                                                                         length,
+                                                                         test_data.crc_seed,
+                                                                         dml::crc,
+                                                                         dml::crc_stream<dml::software>::default_buffer_size);
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+
+    const auto ref = dml::reference::calculate_crc<uint32_t, 0>(test_data.src.data(), test_data.src.data() + length, test_data.crc_seed);
+
+    ASSERT_EQ(result.crc_value, ref);
+}
+
+TYPED_TEST(dmlhl_crc_stream, empty) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto crc_seed = 0x5A5A1234u;
+
+    auto stream = dml::crc_stream<typename TestFixture::execution_path>(crc_seed);
+
+    ASSERT_EQ(stream.update(dml::make_view(static_cast<const uint8_t *>(nullptr), 0u)), dml::status_code::ok);
+
+    auto result = stream.finalize();
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.crc_value, crc_seed);
+}
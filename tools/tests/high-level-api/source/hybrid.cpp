@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Size with a tail, so the CPU part doesn't end on a chunk boundary
+    constexpr uint32_t hybrid_size      = (8u << 20u) + 40u;
+    constexpr uint32_t hybrid_threshold = 1u << 20u;
+
+    // Shares of the hardware change after each operation, so each one is repeated
+    constexpr auto rounds = 4u;
+
+    /**
+     * @brief Enables splitting for the lifetime of the object
+     */
+    struct hybrid_scope
+    {
+        hybrid_scope() noexcept
+        {
+            dml::automatic::set_hybrid_threshold(hybrid_threshold);
+        }
+
+        ~hybrid_scope() noexcept
+        {
+            dml::automatic::set_hybrid_threshold(0u);
+        }
+    };
+
+    std::vector<uint8_t> make_source(uint32_t size)
+    {
+        std::vector<uint8_t> src(size);
+
+        for (uint32_t i = 0u; i < size; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i * 7u + (i >> 11u));
+        }
+
+        return src;
+    }
+}  // namespace
+
+#define SKIP_IF_NO_HARDWARE()                             \
+    if (dml::hardware::get_queue_statistics().empty())    \
+    {                                                     \
+        GTEST_SKIP();                                     \
+    }
+
+TEST(dmlhl_hybrid, mem_move)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = hybrid_scope();
+    auto src   = make_source(hybrid_size);
+
+    for (auto round = 0u; round < rounds; ++round)
+    {
+        auto dst = std::vector<uint8_t>(hybrid_size, 0u);
+
+        auto result = dml::execute<dml::automatic>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(src, dst);
+    }
+}
+
+TEST(dmlhl_hybrid, mem_move_async)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = hybrid_scope();
+    auto src   = make_source(hybrid_size);
+
+    for (auto round = 0u; round < rounds; ++round)
+    {
+        auto dst = std::vector<uint8_t>(hybrid_size, 0u);
+
+        auto handler = dml::submit<dml::automatic>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+
+        while (!handler.is_finished())
+        {
+        }
+
+        ASSERT_EQ(handler.get().status, dml::status_code::ok);
+        ASSERT_EQ(src, dst);
+    }
+
+    // The handler waits for the parts it isn't asked about
+    auto dst = std::vector<uint8_t>(hybrid_size, 0u);
+
+    static_cast<void>(dml::submit<dml::automatic>(dml::mem_move, dml::make_view(src), dml::make_view(dst)));
+
+    ASSERT_EQ(src, dst);
+}
+
+TEST(dmlhl_hybrid, fill)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope = hybrid_scope();
+
+    for (auto round = 0u; round < rounds; ++round)
+    {
+        auto dst = std::vector<uint8_t>(hybrid_size, 0u);
+
+        auto result = dml::execute<dml::automatic>(dml::fill, pattern, dml::make_view(dst));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+
+        for (uint32_t i = 0u; i < hybrid_size; ++i)
+        {
+            ASSERT_EQ(dst[i], static_cast<uint8_t>(pattern >> ((i % 8u) * 8u))) << i;
+        }
+    }
+}
+
+TEST(dmlhl_hybrid, compare)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = hybrid_scope();
+
+    auto src1 = make_source(hybrid_size);
+    auto src2 = src1;
+
+    for (auto round = 0u; round < rounds; ++round)
+    {
+        auto result = dml::execute<dml::automatic>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.result, dml::comparison_result::equal);
+    }
+
+    // Mismatches at the end and the beginning, the first one is reported wherever the split is
+    for (auto mismatch : { hybrid_size - 1u, (5u << 20u) + 3u, (1u << 20u) + 17u, 5u })
+    {
+        src2[mismatch] ^= 0xFFu;
+
+        auto result = dml::execute<dml::automatic>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.result, dml::comparison_result::not_equal);
+        ASSERT_EQ(result.mismatch, mismatch);
+    }
+}
+
+TEST(dmlhl_hybrid, compare_pattern)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope = hybrid_scope();
+    auto src   = std::vector<uint8_t>(hybrid_size, 0u);
+
+    ASSERT_EQ(dml::execute<dml::software>(dml::fill, pattern, dml::make_view(src)).status, dml::status_code::ok);
+
+    auto equal = dml::execute<dml::automatic>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(equal.status, dml::status_code::ok);
+    ASSERT_EQ(equal.result, dml::comparison_result::equal);
+
+    for (auto mismatch : { (7u << 20u) + 8u, 64u })
+    {
+        src[mismatch] ^= 0xFFu;
+
+        auto result = dml::execute<dml::automatic>(dml::compare_pattern, pattern, dml::make_view(src));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.result, dml::comparison_result::not_equal);
+        ASSERT_EQ(result.mismatch, mismatch);
+    }
+}
+
+TEST(dmlhl_hybrid, crc)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint32_t seed = 0x12345678u;
+
+    auto scope = hybrid_scope();
+    auto src   = make_source(hybrid_size);
+
+    const auto check = [&src](auto operation)
+    {
+        const auto expected = dml::execute<dml::software>(operation, dml::make_view(src), seed);
+
+        ASSERT_EQ(expected.status, dml::status_code::ok);
+
+        for (auto round = 0u; round < rounds; ++round)
+        {
+            auto result = dml::execute<dml::automatic>(operation, dml::make_view(src), seed);
+
+            ASSERT_EQ(result.status, dml::status_code::ok);
+            ASSERT_EQ(result.crc_value, expected.crc_value);
+        }
+    };
+
+    check(dml::crc);
+    check(dml::crc.bypass_reflection());
+    check(dml::crc.bypass_data_reflection());
+    check(dml::crc.bypass_reflection().bypass_data_reflection());
+}
@@ -6,6 +6,8 @@
 
 #include "gtest/gtest.h"
 
+#include <numeric>
+
 #include <dml_test_utils/mem_move.hpp>
 
 #include <dml/dml.hpp>
@@ -76,6 +78,36 @@ TYPED_TEST(dmlhl_mem_move, success) {
     }
 }
 
+TYPED_TEST(dmlhl_mem_move, overlapping) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    // Sizes around the largest copy done inline by execute
+    for (auto size: { 1u, 63u, 255u, 256u, 257u, 1024u }) {
+        for (auto shift: { 1u, 16u }) {
+            std::vector<uint8_t> buffer(size + shift);
+            std::iota(buffer.begin(), buffer.end(), uint8_t(0u));
+
+            auto forward = std::vector<uint8_t>(buffer.begin() + shift, buffer.end());
+            auto result  = this->run(dml::mem_move,
+                                    dml::make_view(buffer.data() + shift, size),
+                                    dml::make_view(buffer.data(), size));
+
+            ASSERT_EQ(result.status, dml::status_code::ok) << size;
+            ASSERT_TRUE(std::equal(forward.begin(), forward.end(), buffer.begin())) << size;
+
+            std::iota(buffer.begin(), buffer.end(), uint8_t(0u));
+
+            auto backward = std::vector<uint8_t>(buffer.begin(), buffer.begin() + size);
+            result        = this->run(dml::mem_move,
+                               dml::make_view(buffer.data(), size),
+                               dml::make_view(buffer.data() + shift, size));
+
+            ASSERT_EQ(result.status, dml::status_code::ok) << size;
+            ASSERT_TRUE(std::equal(backward.begin(), backward.end(), buffer.begin() + shift)) << size;
+        }
+    }
+}
+
 TYPED_TEST(dmlhl_mem_move, src_null) {
     constexpr auto size = 16u;
     constexpr auto seed = 777u;
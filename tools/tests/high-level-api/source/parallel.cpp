@@ -0,0 +1,216 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Size with a tail, so the last part is shorter than the others
+    constexpr uint32_t parallel_size      = (8u << 20u) + 40u;
+    constexpr uint32_t parallel_threshold = 1u << 20u;
+
+    /**
+     * @brief Enables splitting for the lifetime of the object
+     */
+    struct parallel_scope
+    {
+        parallel_scope() noexcept
+        {
+            dml::software::set_parallel_threshold(parallel_threshold);
+        }
+
+        ~parallel_scope() noexcept
+        {
+            dml::software::set_parallel_threshold(0u);
+        }
+    };
+
+    std::vector<uint8_t> make_source(uint32_t size)
+    {
+        std::vector<uint8_t> src(size);
+
+        for (uint32_t i = 0u; i < size; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i * 7u + (i >> 11u));
+        }
+
+        return src;
+    }
+}  // namespace
+
+TEST(dmlhl_parallel, mem_move)
+{
+    auto scope = parallel_scope();
+
+    auto src = make_source(parallel_size);
+    auto dst = std::vector<uint8_t>(parallel_size, 0u);
+
+    auto result = dml::execute<dml::software>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(src, dst);
+}
+
+TEST(dmlhl_parallel, mem_move_overlapping)
+{
+    auto scope = parallel_scope();
+
+    auto buffer   = make_source(parallel_size + 4096u);
+    auto expected = std::vector<uint8_t>(buffer.begin(), buffer.begin() + parallel_size);
+
+    auto result = dml::execute<dml::software>(dml::mem_move,
+                                              dml::make_view(buffer.data(), parallel_size),
+                                              dml::make_view(buffer.data() + 4096u, parallel_size));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), buffer.begin() + 4096u));
+}
+
+TEST(dmlhl_parallel, fill)
+{
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope = parallel_scope();
+
+    auto dst = std::vector<uint8_t>(parallel_size, 0u);
+
+    auto result = dml::execute<dml::software>(dml::fill, pattern, dml::make_view(dst));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+
+    for (uint32_t i = 0u; i < parallel_size; ++i)
+    {
+        ASSERT_EQ(dst[i], static_cast<uint8_t>(pattern >> ((i % 8u) * 8u))) << i;
+    }
+}
+
+TEST(dmlhl_parallel, dualcast)
+{
+    auto scope = parallel_scope();
+
+    auto src  = make_source(parallel_size);
+    auto dst1 = std::vector<uint8_t>(parallel_size, 0u);
+    auto dst2 = std::vector<uint8_t>(parallel_size + 4096u, 0u);
+
+    // Destinations must have the same 12 bits of address
+    auto dst2_data = dst2.data() + ((reinterpret_cast<uintptr_t>(dst1.data()) - reinterpret_cast<uintptr_t>(dst2.data())) & 0xFFFu);
+
+    auto result = dml::execute<dml::software>(dml::dualcast,
+                                              dml::make_view(src),
+                                              dml::make_view(dst1),
+                                              dml::make_view(dst2_data, parallel_size));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(src, dst1);
+    ASSERT_TRUE(std::equal(src.begin(), src.end(), dst2_data));
+}
+
+TEST(dmlhl_parallel, compare)
+{
+    auto scope = parallel_scope();
+
+    auto src1 = make_source(parallel_size);
+    auto src2 = src1;
+
+    auto equal = dml::execute<dml::software>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+    ASSERT_EQ(equal.status, dml::status_code::ok);
+    ASSERT_EQ(equal.result, dml::comparison_result::equal);
+
+    // Mismatches in several parts, the first one is reported
+    for (auto mismatch : { parallel_size - 1u, (5u << 20u) + 3u, (3u << 20u) + 17u })
+    {
+        src2[mismatch] ^= 0xFFu;
+
+        auto result = dml::execute<dml::software>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.result, dml::comparison_result::not_equal);
+        ASSERT_EQ(result.mismatch, mismatch);
+    }
+
+    auto expected = dml::execute<dml::software>(dml::compare.expect_not_equal(), dml::make_view(src1), dml::make_view(src2));
+
+    ASSERT_EQ(expected.status, dml::status_code::ok);
+    ASSERT_EQ(expected.result, dml::comparison_result::not_equal);
+
+    auto unexpected = dml::execute<dml::software>(dml::compare.expect_equal(), dml::make_view(src1), dml::make_view(src2));
+
+    ASSERT_EQ(unexpected.status, dml::status_code::false_predicate);
+    ASSERT_EQ(unexpected.mismatch, (3u << 20u) + 17u);
+}
+
+TEST(dmlhl_parallel, compare_pattern)
+{
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope = parallel_scope();
+
+    auto src = std::vector<uint8_t>(parallel_size, 0u);
+
+    auto fill = dml::execute<dml::software>(dml::fill, pattern, dml::make_view(src));
+
+    ASSERT_EQ(fill.status, dml::status_code::ok);
+
+    auto equal = dml::execute<dml::software>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(equal.status, dml::status_code::ok);
+    ASSERT_EQ(equal.result, dml::comparison_result::equal);
+
+    auto expected = dml::execute<dml::software>(dml::compare_pattern.expect_not_equal(), pattern, dml::make_view(src));
+
+    ASSERT_EQ(expected.status, dml::status_code::false_predicate);
+
+    constexpr auto mismatch = (6u << 20u) + 8u;
+
+    src[mismatch] ^= 0xFFu;
+
+    auto result = dml::execute<dml::software>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.result, dml::comparison_result::not_equal);
+    ASSERT_EQ(result.mismatch, mismatch);
+}
+
+TEST(dmlhl_parallel, crc)
+{
+    constexpr uint32_t seed = 0x12345678u;
+
+    auto src = make_source(parallel_size);
+
+    const auto check = [&src](auto operation)
+    {
+        const auto expected = dml::execute<dml::software>(operation, dml::make_view(src), seed);
+
+        auto scope  = parallel_scope();
+        auto result = dml::execute<dml::software>(operation, dml::make_view(src), seed);
+
+        ASSERT_EQ(expected.status, dml::status_code::ok);
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.crc_value, expected.crc_value);
+    };
+
+    check(dml::crc);
+    check(dml::crc.bypass_reflection());
+    check(dml::crc.bypass_data_reflection());
+    check(dml::crc.bypass_reflection().bypass_data_reflection());
+}
+
+TEST(dmlhl_parallel, cache_flush)
+{
+    auto scope = parallel_scope();
+
+    auto dst = make_source(parallel_size);
+
+    auto result = dml::execute<dml::software>(dml::cache_flush, dml::make_view(dst));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+}
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+#include <dml_test_utils/mem_move.hpp>
+#include <t_common.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr auto size         = 1u << 16u;
+    constexpr auto seed         = 777u;
+    constexpr auto handlers_num = 64u;
+
+    /**
+     * @brief Submits operations to the hardware with the policy, checks their results and returns per-queue counter deltas
+     */
+    std::vector<dml::queue_statistics> run_with(dml::queue_selection policy)
+    {
+        dml::hardware::set_queue_selection(policy);
+
+        const auto before = dml::hardware::get_queue_statistics();
+
+        using handler_t = dml::handler<dml::mem_move_operation, std::allocator<dml::byte_t>>;
+
+        std::vector<dml::testing::mem_move> data;
+        std::vector<handler_t>              handlers;
+
+        data.reserve(handlers_num);
+        handlers.reserve(handlers_num);
+
+        for (auto i = 0u; i < handlers_num; ++i)
+        {
+            auto &test_data = data.emplace_back(seed + i, size);
+
+            handlers.emplace_back(dml::submit<dml::hardware>(dml::mem_move, dml::make_view(test_data.src), dml::make_view(test_data.dst)));
+        }
+
+        for (auto i = 0u; i < handlers_num; ++i)
+        {
+            EXPECT_EQ(handlers[i].get().status, dml::status_code::ok);
+            EXPECT_TRUE(data[i].check());
+        }
+
+        dml::hardware::set_queue_selection(dml::queue_selection::round_robin);
+
+        auto after = dml::hardware::get_queue_statistics();
+
+        for (auto idx = 0u; idx < after.size(); ++idx)
+        {
+            after[idx].submissions -= before[idx].submissions;
+            after[idx].retries -= before[idx].retries;
+        }
+
+        return after;
+    }
+
+    auto total_submissions(const std::vector<dml::queue_statistics> &deltas)
+    {
+        auto total = 0ull;
+
+        for (const auto &delta : deltas)
+        {
+            total += delta.submissions;
+        }
+
+        return total;
+    }
+
+    auto total_retries(const std::vector<dml::queue_statistics> &deltas)
+    {
+        auto total = 0ull;
+
+        for (const auto &delta : deltas)
+        {
+            total += delta.retries;
+        }
+
+        return total;
+    }
+}  // namespace
+
+#define SKIP_IF_NOT_HARDWARE                                      \
+    if (dml::test::variables_t::path != DML_PATH_HW)              \
+    {                                                             \
+        GTEST_SKIP();                                             \
+    }
+
+TEST(dmlhl_queue_selection, least_retried)
+{
+    SKIP_IF_NOT_HARDWARE;
+
+    const auto deltas = run_with(dml::queue_selection::least_retried);
+
+    ASSERT_EQ(total_submissions(deltas), handlers_num);
+}
+
+TEST(dmlhl_queue_selection, priority_weighted)
+{
+    SKIP_IF_NOT_HARDWARE;
+
+    const auto deltas = run_with(dml::queue_selection::priority_weighted);
+
+    ASSERT_EQ(total_submissions(deltas), handlers_num);
+
+    // Queues of equal priority take turns
+    const auto equal = std::all_of(deltas.begin(),
+                                   deltas.end(),
+                                   [&deltas](const dml::queue_statistics &delta)
+                                   {
+                                       return delta.priority == deltas.front().priority;
+                                   });
+
+    if (equal && total_retries(deltas) == 0u && handlers_num % deltas.size() == 0u)
+    {
+        for (const auto &delta : deltas)
+        {
+            ASSERT_EQ(delta.submissions, handlers_num / deltas.size());
+        }
+    }
+}
+
+TEST(dmlhl_queue_selection, sticky)
+{
+    SKIP_IF_NOT_HARDWARE;
+
+    const auto deltas = run_with(dml::queue_selection::sticky);
+
+    ASSERT_EQ(total_submissions(deltas), handlers_num);
+
+    // A thread leaves its queue only when the queue rejects a descriptor
+    if (total_retries(deltas) == 0u)
+    {
+        const auto used = std::count_if(deltas.begin(),
+                                        deltas.end(),
+                                        [](const dml::queue_statistics &delta)
+                                        {
+                                            return delta.submissions != 0u;
+                                        });
+
+        ASSERT_EQ(used, 1);
+    }
+}
+
+TEST(dmlhl_queue_selection, round_robin)
+{
+    SKIP_IF_NOT_HARDWARE;
+
+    const auto deltas = run_with(dml::queue_selection::round_robin);
+
+    ASSERT_EQ(total_submissions(deltas), handlers_num);
+}
+
+TEST(dmlhl_queue_selection, dedicated_credits)
+{
+    SKIP_IF_NOT_HARDWARE;
+
+    const auto before = dml::hardware::get_queue_statistics();
+
+    if (std::none_of(before.begin(),
+                     before.end(),
+                     [](const dml::queue_statistics &queue)
+                     {
+                         return queue.dedicated;
+                     }))
+    {
+        GTEST_SKIP();
+    }
+
+    // More submissions than dedicated queues take at once, credits come back as operations complete
+    for (auto round = 0u; round < 4u; ++round)
+    {
+        const auto deltas = run_with(dml::queue_selection::priority_weighted);
+
+        ASSERT_EQ(total_submissions(deltas), handlers_num);
+    }
+
+    const auto after = dml::hardware::get_queue_statistics();
+
+    auto dedicated_submissions = 0ull;
+
+    for (auto idx = 0u; idx < after.size(); ++idx)
+    {
+        if (after[idx].dedicated)
+        {
+            dedicated_submissions += after[idx].submissions - before[idx].submissions;
+
+            EXPECT_EQ(after[idx].occupancy, before[idx].occupancy);
+        }
+    }
+
+    ASSERT_GT(dedicated_submissions, 0u);
+}
+
+TEST(dmlhl_queue_selection, dedicated_dropped)
+{
+    SKIP_IF_NOT_HARDWARE;
+
+    const auto before = dml::hardware::get_queue_statistics();
+
+    if (std::none_of(before.begin(),
+                     before.end(),
+                     [](const dml::queue_statistics &queue)
+                     {
+                         return queue.dedicated;
+                     }))
+    {
+        GTEST_SKIP();
+    }
+
+    dml::hardware::set_queue_selection(dml::queue_selection::round_robin);
+
+    auto test_data = dml::testing::mem_move(seed, size);
+
+    // Handlers aren't asked for results, so dropping them returns the credits. Each queue gets more than it holds
+    for (auto i = 0u; i < handlers_num * before.size(); ++i)
+    {
+        static_cast<void>(dml::submit<dml::hardware>(dml::mem_move, dml::make_view(test_data.src), dml::make_view(test_data.dst)));
+    }
+
+    ASSERT_TRUE(test_data.check());
+
+    const auto after = dml::hardware::get_queue_statistics();
+
+    auto dedicated_submissions = 0ull;
+
+    for (auto idx = 0u; idx < after.size(); ++idx)
+    {
+        if (after[idx].dedicated)
+        {
+            dedicated_submissions += after[idx].submissions - before[idx].submissions;
+
+            EXPECT_EQ(after[idx].occupancy, before[idx].occupancy);
+        }
+    }
+
+    ASSERT_GT(dedicated_submissions, 0u);
+}
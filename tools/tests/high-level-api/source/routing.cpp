@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+#include <dml_test_utils/mem_move.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr auto size         = 1u << 16u;
+    constexpr auto seed         = 777u;
+    constexpr auto handlers_num = 16u;
+
+    auto temp_path(const char *name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    void write_file(const std::string &path, const char *content)
+    {
+        auto file = std::fopen(path.c_str(), "w");
+        ASSERT_NE(file, nullptr);
+        std::fputs(content, file);
+        std::fclose(file);
+    }
+
+    auto read_file(const std::string &path)
+    {
+        auto stream = std::stringstream();
+        stream << std::ifstream(path).rdbuf();
+
+        return stream.str();
+    }
+
+    /**
+     * @brief Submits Memory Move operations to the automatic path, checks results and returns hardware submissions
+     */
+    auto submissions_of_automatic()
+    {
+        const auto count = []
+        {
+            auto total = 0ull;
+
+            for (const auto &queue : dml::hardware::get_queue_statistics())
+            {
+                total += queue.submissions;
+            }
+
+            return total;
+        };
+
+        const auto before = count();
+
+        for (auto i = 0u; i < handlers_num; ++i)
+        {
+            auto data = dml::testing::mem_move(seed + i, size);
+
+            auto result = dml::execute<dml::automatic>(dml::mem_move, dml::make_view(data.src), dml::make_view(data.dst));
+
+            EXPECT_EQ(result.status, dml::status_code::ok);
+            EXPECT_TRUE(data.check());
+        }
+
+        return count() - before;
+    }
+
+    constexpr auto cpu_is_faster = "mem_move software 10 10 10 10 10 10 10 10 10\n"
+                                   "mem_move hardware 1000000 1000000 1000000 1000000 1000000 1000000 1000000 1000000 1000000\n";
+
+    constexpr auto hardware_is_faster = "mem_move software 1000000 1000000 1000000 1000000 1000000 1000000 1000000 1000000 1000000\n"
+                                        "mem_move hardware 10 10 10 10 10 10 10 10 10\n";
+}  // namespace
+
+TEST(dmlhl_routing, file)
+{
+    const auto path  = temp_path("dml_routing_test.txt");
+    const auto saved = temp_path("dml_routing_saved_test.txt");
+
+    write_file(path, cpu_is_faster);
+
+    ASSERT_TRUE(dml::automatic::load_routing(path.c_str()));
+    ASSERT_TRUE(dml::automatic::save_routing(saved.c_str()));
+    ASSERT_EQ(read_file(saved), cpu_is_faster);
+
+    // Malformed files keep the routing
+    write_file(path, "mem_move software 10 10\n");
+    ASSERT_FALSE(dml::automatic::load_routing(path.c_str()));
+
+    write_file(path, "mem_move cpu 10 10 10 10 10 10 10 10 10\n");
+    ASSERT_FALSE(dml::automatic::load_routing(path.c_str()));
+
+    ASSERT_TRUE(dml::automatic::save_routing(saved.c_str()));
+    ASSERT_EQ(read_file(saved), cpu_is_faster);
+
+    dml::automatic::reset_routing();
+
+    ASSERT_TRUE(dml::automatic::save_routing(saved.c_str()));
+    ASSERT_EQ(read_file(saved), "");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(saved);
+
+    ASSERT_FALSE(dml::automatic::load_routing(path.c_str()));
+}
+
+TEST(dmlhl_routing, follows_costs)
+{
+    if (dml::hardware::get_queue_statistics().empty())
+    {
+        GTEST_SKIP();
+    }
+
+    const auto path = temp_path("dml_routing_test.txt");
+
+    write_file(path, cpu_is_faster);
+    ASSERT_TRUE(dml::automatic::load_routing(path.c_str()));
+    ASSERT_EQ(submissions_of_automatic(), 0u);
+
+    write_file(path, hardware_is_faster);
+    ASSERT_TRUE(dml::automatic::load_routing(path.c_str()));
+    ASSERT_GT(submissions_of_automatic(), 0u);
+
+    dml::automatic::reset_routing();
+    std::filesystem::remove(path);
+}
+
+TEST(dmlhl_routing, calibrate)
+{
+    if (dml::hardware::get_queue_statistics().empty())
+    {
+        GTEST_SKIP();
+    }
+
+    const auto path = temp_path("dml_routing_test.txt");
+
+    dml::automatic::calibrate_routing();
+
+    ASSERT_TRUE(dml::automatic::save_routing(path.c_str()));
+    ASSERT_NE(read_file(path).find("mem_move hardware"), std::string::npos);
+
+    // Results don't depend on the route
+    static_cast<void>(submissions_of_automatic());
+
+    dml::automatic::reset_routing();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,430 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+
+namespace
+{
+    // Size with a tail, so the last part is shorter than the others
+    constexpr uint32_t striping_size      = (8u << 20u) + 40u;
+    constexpr uint32_t striping_threshold = 1u << 20u;
+
+    /**
+     * @brief Enables striping for the lifetime of the object
+     */
+    struct striping_scope
+    {
+        striping_scope() noexcept
+        {
+            dml::hardware::set_striping_threshold(striping_threshold);
+        }
+
+        ~striping_scope() noexcept
+        {
+            dml::hardware::set_striping_threshold(0u);
+        }
+    };
+
+    std::vector<uint8_t> make_source(uint32_t size)
+    {
+        std::vector<uint8_t> src(size);
+
+        for (uint32_t i = 0u; i < size; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i * 7u + (i >> 11u));
+        }
+
+        return src;
+    }
+
+    auto submissions_per_device()
+    {
+        auto submissions = std::vector<uint64_t>();
+
+        for (const auto &queue : dml::hardware::get_queue_statistics())
+        {
+            submissions.resize(std::max<size_t>(submissions.size(), queue.device + 1u));
+            submissions[queue.device] += queue.submissions;
+        }
+
+        return submissions;
+    }
+
+#if defined(__linux__)
+    /**
+     * @brief Anonymous mapping, a page dropped with MADV_DONTNEED faults on the device and reads as zeros
+     */
+    class mapped_buffer
+    {
+    public:
+        explicit mapped_buffer(const std::vector<uint8_t> &content) noexcept
+            : size_(content.size())
+        {
+            data_ = static_cast<uint8_t *>(mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            std::copy(content.begin(), content.end(), data_);
+        }
+
+        mapped_buffer(const mapped_buffer &) = delete;
+
+        ~mapped_buffer() noexcept
+        {
+            munmap(data_, size_);
+        }
+
+        void drop_page(size_t offset) noexcept
+        {
+            const auto page_size = static_cast<size_t>(getpagesize());
+
+            madvise(data_ + (offset & ~(page_size - 1u)), page_size, MADV_DONTNEED);
+        }
+
+        [[nodiscard]] uint8_t *begin() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] uint8_t *end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+    private:
+        uint8_t *data_;
+        size_t   size_;
+    };
+
+    // Fault in the first part, difference in the last one
+    constexpr uint32_t fault_offset    = 2u << 12u;
+    constexpr uint32_t mismatch_offset = striping_size - 100u;
+#endif
+}  // namespace
+
+#define SKIP_IF_NO_HARDWARE()                             \
+    if (dml::hardware::get_queue_statistics().empty())    \
+    {                                                     \
+        GTEST_SKIP();                                     \
+    }
+
+TEST(dmlhl_striping, mem_move)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = striping_scope();
+
+    auto src = make_source(striping_size);
+    auto dst = std::vector<uint8_t>(striping_size, 0u);
+
+    const auto before = submissions_per_device();
+
+    auto result = dml::execute<dml::hardware>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+
+    const auto after = submissions_per_device();
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(src, dst);
+
+    // Each device takes a part
+    for (auto device = 0u; device < after.size(); ++device)
+    {
+        ASSERT_GT(after[device], before[device]) << device;
+    }
+}
+
+TEST(dmlhl_striping, mem_move_async)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = striping_scope();
+
+    auto src = make_source(striping_size);
+    auto dst = std::vector<uint8_t>(striping_size, 0u);
+
+    auto handler = dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+
+    while (!handler.is_finished())
+    {
+    }
+
+    ASSERT_EQ(handler.get().status, dml::status_code::ok);
+    ASSERT_EQ(src, dst);
+}
+
+TEST(dmlhl_striping, mem_move_dropped)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = striping_scope();
+
+    auto src = make_source(striping_size);
+    auto dst = std::vector<uint8_t>(striping_size, 0u);
+
+    // The handler waits for the parts it isn't asked about
+    for (auto round = 0u; round < 4u; ++round)
+    {
+        static_cast<void>(dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src), dml::make_view(dst)));
+
+        ASSERT_EQ(src, dst);
+
+        dst.assign(striping_size, 0u);
+    }
+}
+
+TEST(dmlhl_striping, mem_move_policy)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope  = striping_scope();
+    auto policy = dml::wait_policy().spin(0u).umwait(0u, 0u);
+
+    auto src = make_source(striping_size);
+    auto dst = std::vector<uint8_t>(striping_size, 0u);
+
+    auto handler = dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+
+    ASSERT_EQ(handler.get(policy).status, dml::status_code::ok);
+    ASSERT_EQ(src, dst);
+
+    // Parts are waited for with the policy, and the stripe counts as one wait
+    const auto statistics = policy.get_statistics();
+
+    ASSERT_LE(statistics.waits, 1u);
+    ASSERT_EQ(statistics.waits, statistics.yield_completions);
+}
+
+TEST(dmlhl_striping, fill)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope = striping_scope();
+
+    auto dst = std::vector<uint8_t>(striping_size, 0u);
+
+    auto result = dml::execute<dml::hardware>(dml::fill, pattern, dml::make_view(dst));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+
+    for (uint32_t i = 0u; i < striping_size; ++i)
+    {
+        ASSERT_EQ(dst[i], static_cast<uint8_t>(pattern >> ((i % 8u) * 8u))) << i;
+    }
+}
+
+TEST(dmlhl_striping, compare)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = striping_scope();
+
+    auto src1 = make_source(striping_size);
+    auto src2 = src1;
+
+    auto equal = dml::execute<dml::hardware>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+    ASSERT_EQ(equal.status, dml::status_code::ok);
+    ASSERT_EQ(equal.result, dml::comparison_result::equal);
+
+    // Mismatches in several parts, the first one is reported
+    for (auto mismatch : { striping_size - 1u, (5u << 20u) + 3u, (1u << 20u) + 17u })
+    {
+        src2[mismatch] ^= 0xFFu;
+
+        auto result = dml::execute<dml::hardware>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.result, dml::comparison_result::not_equal);
+        ASSERT_EQ(result.mismatch, mismatch);
+    }
+}
+
+TEST(dmlhl_striping, compare_pattern)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope = striping_scope();
+    auto src   = std::vector<uint8_t>(striping_size, 0u);
+
+    ASSERT_EQ(dml::execute<dml::software>(dml::fill, pattern, dml::make_view(src)).status, dml::status_code::ok);
+
+    auto equal = dml::execute<dml::hardware>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(equal.status, dml::status_code::ok);
+    ASSERT_EQ(equal.result, dml::comparison_result::equal);
+
+    constexpr auto mismatch = (6u << 20u) + 8u;
+
+    src[mismatch] ^= 0xFFu;
+
+    auto result = dml::execute<dml::hardware>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.result, dml::comparison_result::not_equal);
+    ASSERT_EQ(result.mismatch, mismatch);
+}
+
+TEST(dmlhl_striping, crc)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint32_t seed = 0x12345678u;
+
+    auto scope = striping_scope();
+    auto src   = make_source(striping_size);
+
+    const auto check = [&src](auto operation)
+    {
+        const auto expected = dml::execute<dml::software>(operation, dml::make_view(src), seed);
+        const auto result   = dml::execute<dml::hardware>(operation, dml::make_view(src), seed);
+
+        ASSERT_EQ(expected.status, dml::status_code::ok);
+        ASSERT_EQ(result.status, dml::status_code::ok);
+        ASSERT_EQ(result.crc_value, expected.crc_value);
+    };
+
+    check(dml::crc);
+    check(dml::crc.bypass_reflection());
+    check(dml::crc.bypass_data_reflection());
+    check(dml::crc.bypass_reflection().bypass_data_reflection());
+}
+
+TEST(dmlhl_striping, cache_flush)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = striping_scope();
+    auto dst   = make_source(striping_size);
+
+    auto result = dml::execute<dml::hardware>(dml::cache_flush, dml::make_view(dst));
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+}
+
+#if defined(__linux__)
+TEST(dmlhl_striping, compare_fault)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    auto scope = striping_scope();
+
+    auto content = make_source(striping_size);
+    auto src1    = mapped_buffer(content);
+
+    content[mismatch_offset] ^= 0xFFu;
+
+    auto src2 = mapped_buffer(content);
+
+    // Part with the fault goes before the part with the difference
+    src1.drop_page(fault_offset);
+
+    auto result = dml::execute<dml::hardware>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+    ASSERT_EQ(result.status, dml::status_code::partial_completion);
+    ASSERT_LE(result.mismatch, fault_offset);
+
+    // The dropped page reads as zeros, so continuation finds the difference there
+    src1.drop_page(fault_offset);
+
+    auto continued = dml::execute<dml::automatic>(dml::compare, dml::make_view(src1), dml::make_view(src2));
+
+    ASSERT_EQ(continued.status, dml::status_code::ok);
+    ASSERT_EQ(continued.result, dml::comparison_result::not_equal);
+    ASSERT_EQ(continued.mismatch, fault_offset);
+}
+
+TEST(dmlhl_striping, compare_pattern_fault)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    auto scope   = striping_scope();
+    auto content = std::vector<uint8_t>(striping_size, 0u);
+
+    ASSERT_EQ(dml::execute<dml::software>(dml::fill, pattern, dml::make_view(content)).status, dml::status_code::ok);
+
+    content[mismatch_offset] ^= 0xFFu;
+
+    auto src = mapped_buffer(content);
+
+    src.drop_page(fault_offset);
+
+    auto result = dml::execute<dml::hardware>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(result.status, dml::status_code::partial_completion);
+    ASSERT_LE(result.mismatch, fault_offset);
+
+    src.drop_page(fault_offset);
+
+    auto continued = dml::execute<dml::automatic>(dml::compare_pattern, pattern, dml::make_view(src));
+
+    ASSERT_EQ(continued.status, dml::status_code::ok);
+    ASSERT_EQ(continued.result, dml::comparison_result::not_equal);
+    ASSERT_EQ(continued.mismatch, fault_offset);
+}
+
+TEST(dmlhl_striping, create_delta_fault)
+{
+    SKIP_IF_NO_HARDWARE();
+
+    // Largest transfer Create Delta takes, the descriptor is submitted whole
+    constexpr uint32_t delta_size     = 1u << 19u;
+    constexpr uint32_t delta_mismatch = delta_size - 64u;
+
+    auto scope = striping_scope();
+
+    auto content = make_source(delta_size);
+    auto src1    = mapped_buffer(content);
+
+    content[delta_mismatch] ^= 0xFFu;
+
+    auto src2  = mapped_buffer(content);
+    auto delta = std::vector<uint8_t>(delta_size / 8u * 10u, 0u);
+
+    src1.drop_page(fault_offset);
+
+    auto result = dml::execute<dml::hardware>(dml::create_delta,
+                                              dml::make_view(src1),
+                                              dml::make_view(src2),
+                                              dml::make_view(delta));
+
+    ASSERT_EQ(result.status, dml::status_code::partial_completion);
+    ASSERT_LE(result.bytes_completed, fault_offset);
+
+    src1.drop_page(fault_offset);
+
+    auto continued = dml::execute<dml::automatic>(dml::create_delta,
+                                                  dml::make_view(src1),
+                                                  dml::make_view(src2),
+                                                  dml::make_view(delta));
+
+    // Dropped page reads as zeros on the CPU, so the software path sees the same data
+    auto expected_delta = std::vector<uint8_t>(delta.size(), 0u);
+    auto expected       = dml::execute<dml::software>(dml::create_delta,
+                                                dml::make_view(src1),
+                                                dml::make_view(src2),
+                                                dml::make_view(expected_delta));
+
+    ASSERT_EQ(expected.status, dml::status_code::ok);
+    ASSERT_EQ(continued.status, dml::status_code::ok);
+    ASSERT_EQ(continued.result, dml::comparison_result::not_equal);
+    ASSERT_EQ(continued.delta_record_size, expected.delta_record_size);
+    ASSERT_EQ(delta, expected_delta);
+}
+#endif
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+#include <dml_test_utils/mem_move.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(dmlhl_thread_pool, runs_all_tasks)
+{
+    constexpr auto tasks_count = 1000u;
+
+    auto counter = std::atomic<uint32_t>(0u);
+
+    {
+        auto pool = dml::thread_pool(4u);
+
+        ASSERT_EQ(pool.size(), 4u);
+
+        for (auto i = 0u; i < tasks_count; ++i)
+        {
+            pool.submit(
+                [&counter, &pool]
+                {
+                    // Nested submission goes to the worker's own queue
+                    pool.submit(
+                        [&counter]
+                        {
+                            counter.fetch_add(1u);
+                        });
+                });
+        }
+    }
+
+    ASSERT_EQ(counter.load(), tasks_count);
+}
+
+TEST(dmlhl_thread_pool, user_pool_submit)
+{
+    constexpr auto size         = 4096u;
+    constexpr auto seed         = 777u;
+    constexpr auto handlers_num = 64u;
+
+    auto pool     = dml::thread_pool(2u);
+    auto executor = dml::execution_interface(dml::software::default_thread_spawner(pool), std::allocator<dml::byte_t>());
+
+    using handler_t = dml::handler<dml::mem_move_operation, std::allocator<dml::byte_t>>;
+
+    std::vector<dml::testing::mem_move> data;
+    std::vector<handler_t>              handlers;
+
+    data.reserve(handlers_num);
+    handlers.reserve(handlers_num);
+
+    for (auto i = 0u; i < handlers_num; ++i)
+    {
+        data.emplace_back(seed + i, size);
+    }
+
+    for (auto i = 0u; i < handlers_num; ++i)
+    {
+        handlers.push_back(dml::submit<dml::software>(dml::mem_move, dml::make_view(data[i].src), dml::make_view(data[i].dst), executor));
+    }
+
+    for (auto i = 0u; i < handlers_num; ++i)
+    {
+        ASSERT_EQ(handlers[i].get().status, dml::status_code::ok);
+        ASSERT_TRUE(data[i].check());
+    }
+}
+
+TEST(dmlhl_thread_pool, handler_destructor_waits)
+{
+    constexpr auto size = 1024u * 1024u;
+    constexpr auto seed = 777u;
+
+    auto data = dml::testing::mem_move(seed, size);
+
+    {
+        auto handler = dml::submit<dml::software>(dml::mem_move, dml::make_view(data.src), dml::make_view(data.dst));
+
+        ASSERT_TRUE(handler.valid());
+    }
+
+    ASSERT_TRUE(data.check());
+}
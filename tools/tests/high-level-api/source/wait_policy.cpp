@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/dml.hpp>
+#include <dml_test_utils/mem_move.hpp>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr auto size         = 1u << 20u;
+    constexpr auto seed         = 777u;
+    constexpr auto handlers_num = 16u;
+
+    /**
+     * @brief Waits for asynchronous software operations with the policy and checks their results
+     */
+    void run_with(const dml::wait_policy &policy)
+    {
+        auto pool     = dml::thread_pool(2u);
+        auto executor = dml::execution_interface(dml::software::default_thread_spawner(pool), std::allocator<dml::byte_t>());
+
+        using handler_t = dml::handler<dml::mem_move_operation, std::allocator<dml::byte_t>>;
+
+        std::vector<dml::testing::mem_move> data;
+        std::vector<handler_t>              handlers;
+
+        data.reserve(handlers_num);
+        handlers.reserve(handlers_num);
+
+        for (auto i = 0u; i < handlers_num; ++i)
+        {
+            auto &test_data = data.emplace_back(seed + i, size);
+
+            handlers.emplace_back(
+                dml::submit<dml::software>(dml::mem_move, dml::make_view(test_data.src), dml::make_view(test_data.dst), executor));
+        }
+
+        for (auto i = 0u; i < handlers_num; ++i)
+        {
+            ASSERT_EQ(handlers[i].get(policy).status, dml::status_code::ok);
+            ASSERT_TRUE(data[i].check());
+        }
+    }
+
+    void check_consistent(const dml::wait_statistics &statistics)
+    {
+        ASSERT_LE(statistics.waits, handlers_num);
+        ASSERT_EQ(statistics.waits, statistics.spin_completions + statistics.umwait_completions + statistics.yield_completions);
+    }
+}  // namespace
+
+TEST(dmlhl_wait_policy, default_stages)
+{
+    auto policy = dml::wait_policy();
+
+    run_with(policy);
+
+    check_consistent(policy.get_statistics());
+}
+
+TEST(dmlhl_wait_policy, spin_only)
+{
+    auto policy = dml::wait_policy().spin(~0u).umwait(0u, 0u);
+
+    run_with(policy);
+
+    const auto statistics = policy.get_statistics();
+
+    check_consistent(statistics);
+    ASSERT_EQ(statistics.waits, statistics.spin_completions);
+}
+
+TEST(dmlhl_wait_policy, umwait_states)
+{
+    for (auto state : { dml::umwait_state::c0_1, dml::umwait_state::c0_2 })
+    {
+        auto policy = dml::wait_policy().spin(0u).umwait(~0u, 1000u, state);
+
+        run_with(policy);
+
+        const auto statistics = policy.get_statistics();
+
+        check_consistent(statistics);
+        ASSERT_EQ(statistics.waits, statistics.umwait_completions);
+    }
+}
+
+TEST(dmlhl_wait_policy, yield_only)
+{
+    auto policy = dml::wait_policy().spin(0u).umwait(0u, 0u);
+
+    run_with(policy);
+
+    const auto statistics = policy.get_statistics();
+
+    check_consistent(statistics);
+    ASSERT_EQ(statistics.waits, statistics.yield_completions);
+}
+
+TEST(dmlhl_wait_policy, copies_share_statistics)
+{
+    auto policy = dml::wait_policy().spin(0u).umwait(0u, 0u);
+    auto copy   = policy;
+
+    run_with(copy);
+
+    const auto statistics = policy.get_statistics();
+    const auto copied     = copy.get_statistics();
+
+    ASSERT_EQ(statistics.waits, copied.waits);
+    ASSERT_EQ(statistics.yield_completions, copied.yield_completions);
+}
@@ -51,4 +51,66 @@ TEST(dml_wait, umwait)
 
     ASSERT_EQ(src, dst);
 }
+
+TEST(dml_wait, async_submit)
+{
+    auto transfer_size = 1024u * 1024u; // 1MB
+
+    auto src = std::vector<std::uint8_t>(transfer_size, 1);
+    auto dst = std::vector<std::uint8_t>(transfer_size, 0);
+
+    auto job = test::job_t(test::variables_t::path);
+    job->operation = DML_OP_MEM_MOVE;
+    job->source_first_ptr = src.data();
+    job->destination_first_ptr = dst.data();
+    job->source_length = transfer_size;
+    job->flags |= DML_FLAG_ASYNC_SUBMIT;
+
+    ASSERT_EQ(DML_STATUS_OK, dml_submit_job(&(*job)));
+
+    auto status = dml_check_job(&(*job));
+    while (DML_STATUS_BEING_PROCESSED == status)
+    {
+        status = dml_check_job(&(*job));
+    }
+
+    ASSERT_EQ(DML_STATUS_OK, status);
+    ASSERT_EQ(src, dst);
+}
+
+TEST(dml_wait, async_submit_copy_only)
+{
+    auto transfer_size = 1024u * 1024u; // 1MB
+
+    auto src = std::vector<std::uint8_t>(transfer_size, 1);
+    auto dst = std::vector<std::uint8_t>(transfer_size, 0);
+
+    auto job = test::job_t(test::variables_t::path);
+    job->operation = DML_OP_MEM_MOVE;
+    job->source_first_ptr = src.data();
+    job->destination_first_ptr = dst.data();
+    job->source_length = transfer_size;
+    job->flags |= DML_FLAG_COPY_ONLY | DML_FLAG_ASYNC_SUBMIT;
+
+    ASSERT_EQ(DML_STATUS_OK, dml_submit_job(&(*job)));
+
+    // Dropping Copy Only flag keeps the job asynchronous
+    ASSERT_NE(0u, job->flags & DML_FLAG_ASYNC_SUBMIT);
+
+    auto status = dml_check_job(&(*job));
+    while (DML_STATUS_BEING_PROCESSED == status)
+    {
+        status = dml_check_job(&(*job));
+    }
+
+    ASSERT_EQ(DML_STATUS_OK, status);
+    ASSERT_EQ(src, dst);
+
+    // The job can be submitted again with the same flags
+    std::fill(dst.begin(), dst.end(), 0u);
+
+    ASSERT_EQ(DML_STATUS_OK, dml_submit_job(&(*job)));
+    ASSERT_EQ(DML_STATUS_OK, dml_wait_job(&(*job), DML_WAIT_MODE_BUSY_POLL));
+    ASSERT_EQ(src, dst);
+}
 }